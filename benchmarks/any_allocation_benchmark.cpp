@@ -0,0 +1,182 @@
+#include "behaviortree_cpp/bt_factory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Count the heap allocations performed per tick on representative trees.
+// The values written into the blackboard are stored in BT::Any; the ones
+// that fit into its inline storage (see BTCPP_ANY_INLINE_CAPACITY) should
+// not allocate at all, once the tree reached its steady state.
+
+namespace
+{
+std::atomic<size_t> allocations_count{ 0 };
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+  allocations_count.fetch_add(1, std::memory_order_relaxed);
+  if(void* ptr = std::malloc(size == 0 ? 1 : size))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace
+{
+struct Point3D
+{
+  double x, y, z;
+};
+
+struct Quaternion
+{
+  double x, y, z, w;
+};
+
+struct Pose3D
+{
+  Point3D position;
+  Quaternion orientation;
+};
+
+class WriteGeometry : public BT::SyncActionNode
+{
+public:
+  WriteGeometry(const std::string& name, const BT::NodeConfig& config)
+    : BT::SyncActionNode(name, config)
+  {}
+
+  BT::NodeStatus tick() override
+  {
+    counter_ += 1.0;
+    setOutput("point", Point3D{ counter_, 0, 0 });
+    setOutput("orientation", Quaternion{ 0, 0, 0, counter_ });
+    setOutput("pose", Pose3D{ { counter_, 0, 0 }, { 0, 0, 0, 1 } });
+    return BT::NodeStatus::SUCCESS;
+  }
+
+  static BT::PortsList providedPorts()
+  {
+    return { BT::OutputPort<Point3D>("point"), BT::OutputPort<Quaternion>("orientation"),
+             BT::OutputPort<Pose3D>("pose") };
+  }
+
+private:
+  double counter_ = 0;
+};
+
+class ReadGeometry : public BT::SyncActionNode
+{
+public:
+  ReadGeometry(const std::string& name, const BT::NodeConfig& config)
+    : BT::SyncActionNode(name, config)
+  {}
+
+  BT::NodeStatus tick() override
+  {
+    auto point = getInput<Point3D>("point");
+    auto orientation = getInput<Quaternion>("orientation");
+    auto pose = getInput<Pose3D>("pose");
+    return (point && orientation && pose) ? BT::NodeStatus::SUCCESS :
+                                            BT::NodeStatus::FAILURE;
+  }
+
+  static BT::PortsList providedPorts()
+  {
+    return { BT::InputPort<Point3D>("point"), BT::InputPort<Quaternion>("orientation"),
+             BT::InputPort<Pose3D>("pose") };
+  }
+};
+
+// Tick the tree a few times, to reach the steady state, then measure
+void RunTree(benchmark::State& state, BT::Tree& tree)
+{
+  for(int i = 0; i < 10; i++)
+  {
+    tree.tickOnce();
+  }
+  const size_t before = allocations_count.load();
+  for(auto _ : state)
+  {
+    tree.tickOnce();
+  }
+  const size_t allocations = allocations_count.load() - before;
+  state.counters["allocs_per_tick"] =
+      benchmark::Counter(double(allocations) / double(state.iterations()));
+  state.counters["inline_capacity"] = double(BTCPP_ANY_INLINE_CAPACITY);
+}
+
+void BM_ScriptNumbers(benchmark::State& state)
+{
+  static const char* xml_text = R"(
+<root BTCPP_format="4">
+  <BehaviorTree ID="MainTree">
+    <Sequence>
+      <Script code="a:=1.5; b:=a+2; c:=b*a" />
+      <Script code="counter:=counter+1" />
+    </Sequence>
+  </BehaviorTree>
+</root>)";
+
+  BT::BehaviorTreeFactory factory;
+  auto tree = factory.createTreeFromText(xml_text);
+  tree.rootBlackboard()->set("counter", 0);
+  RunTree(state, tree);
+}
+
+void BM_ScriptStrings(benchmark::State& state)
+{
+  static const char* xml_text = R"(
+<root BTCPP_format="4">
+  <BehaviorTree ID="MainTree">
+    <Sequence>
+      <Script code="short:='hello'" />
+      <Script code="long:='a string longer than the SSO of SimpleString'" />
+    </Sequence>
+  </BehaviorTree>
+</root>)";
+
+  BT::BehaviorTreeFactory factory;
+  auto tree = factory.createTreeFromText(xml_text);
+  RunTree(state, tree);
+}
+
+void BM_GeometryPorts(benchmark::State& state)
+{
+  static const char* xml_text = R"(
+<root BTCPP_format="4">
+  <BehaviorTree ID="MainTree">
+    <Sequence>
+      <WriteGeometry point="{point}" orientation="{orientation}" pose="{pose}" />
+      <ReadGeometry  point="{point}" orientation="{orientation}" pose="{pose}" />
+    </Sequence>
+  </BehaviorTree>
+</root>)";
+
+  BT::BehaviorTreeFactory factory;
+  factory.registerNodeType<WriteGeometry>("WriteGeometry");
+  factory.registerNodeType<ReadGeometry>("ReadGeometry");
+  auto tree = factory.createTreeFromText(xml_text);
+  RunTree(state, tree);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ScriptNumbers);
+BENCHMARK(BM_ScriptStrings);
+BENCHMARK(BM_GeometryPorts);
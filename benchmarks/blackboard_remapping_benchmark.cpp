@@ -0,0 +1,84 @@
+#include "behaviortree_cpp/blackboard.h"
+
+#include <benchmark/benchmark.h>
+
+// Compare the cost of reading a local entry with the cost of reading an entry
+// of the root blackboard through a chain of nested blackboards, as created
+// by nested SubTrees, using either autoremapping, explicit remapping or "@".
+
+namespace
+{
+struct Chain
+{
+  std::vector<BT::Blackboard::Ptr> blackboards;
+
+  BT::Blackboard& leaf()
+  {
+    return *blackboards.back();
+  }
+};
+
+Chain CreateChain(int depth, bool autoremap)
+{
+  Chain chain;
+  chain.blackboards.push_back(BT::Blackboard::create());
+  chain.blackboards.back()->set("value", 42);
+  for(int i = 0; i < depth; i++)
+  {
+    auto bb = BT::Blackboard::create(chain.blackboards.back());
+    if(autoremap)
+    {
+      bb->enableAutoRemapping(true);
+    }
+    else
+    {
+      bb->addSubtreeRemapping("value", "value");
+    }
+    chain.blackboards.push_back(bb);
+  }
+  chain.leaf().set("local_value", 42);
+  return chain;
+}
+
+void BM_LocalEntry(benchmark::State& state)
+{
+  auto chain = CreateChain(int(state.range(0)), true);
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(chain.leaf().get<int>("local_value"));
+  }
+}
+
+void BM_AutoRemappedEntry(benchmark::State& state)
+{
+  auto chain = CreateChain(int(state.range(0)), true);
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(chain.leaf().get<int>("value"));
+  }
+}
+
+void BM_RemappedEntry(benchmark::State& state)
+{
+  auto chain = CreateChain(int(state.range(0)), false);
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(chain.leaf().get<int>("value"));
+  }
+}
+
+void BM_RootEntry(benchmark::State& state)
+{
+  auto chain = CreateChain(int(state.range(0)), false);
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(chain.leaf().get<int>("@value"));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_LocalEntry)->Arg(1)->Arg(8);
+BENCHMARK(BM_AutoRemappedEntry)->Arg(1)->Arg(8);
+BENCHMARK(BM_RemappedEntry)->Arg(1)->Arg(8);
+BENCHMARK(BM_RootEntry)->Arg(1)->Arg(8);
@@ -0,0 +1,65 @@
+#include "behaviortree_cpp/bt_factory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+// Latency of a tick of a Parallel and of a ConcurrentParallel with N children,
+// each one performing a synchronous, CPU-bound check of about 200 usec.
+// The latency of the ConcurrentParallel is expected to scale with the number
+// of cores, instead of the number of children.
+
+namespace
+{
+BT::NodeStatus HeavyCheck()
+{
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(200);
+  double value = 1.0;
+  while(std::chrono::steady_clock::now() < deadline)
+  {
+    for(int i = 0; i < 100; i++)
+    {
+      value = std::sqrt(value + 1.0);
+    }
+  }
+  benchmark::DoNotOptimize(value);
+  return BT::NodeStatus::SUCCESS;
+}
+
+void RunParallel(benchmark::State& state, const char* node_id)
+{
+  std::string xml = R"(<root BTCPP_format="4"><BehaviorTree ID="MainTree">)";
+  xml += std::string("<") + node_id + ">";
+  for(int i = 0; i < state.range(0); i++)
+  {
+    xml += "<HeavyCheck/>";
+  }
+  xml += std::string("</") + node_id + "></BehaviorTree></root>";
+
+  BT::BehaviorTreeFactory factory;
+  factory.registerSimpleCondition("HeavyCheck", [](BT::TreeNode&) { return HeavyCheck(); });
+  auto tree = factory.createTreeFromText(xml);
+
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(tree.tickOnce());
+  }
+  state.counters["cores"] = double(std::thread::hardware_concurrency());
+}
+
+void BM_Parallel(benchmark::State& state)
+{
+  RunParallel(state, "Parallel");
+}
+
+void BM_ConcurrentParallel(benchmark::State& state)
+{
+  RunParallel(state, "ConcurrentParallel");
+}
+
+}  // namespace
+
+BENCHMARK(BM_Parallel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BM_ConcurrentParallel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
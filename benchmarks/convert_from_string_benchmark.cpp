@@ -0,0 +1,76 @@
+#include "behaviortree_cpp/basic_types.h"
+#include "behaviortree_cpp/utils/safe_any.hpp"
+
+#include <benchmark/benchmark.h>
+
+// Compare the throwing convertFromString() with tryConvertFromString(),
+// on the types most commonly used in ports, both when the string
+// is valid and when it is not.
+
+namespace
+{
+void BM_ConvertInt(benchmark::State& state)
+{
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(BT::convertFromString<int>("-12345"));
+  }
+}
+
+void BM_ConvertDouble(benchmark::State& state)
+{
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(BT::convertFromString<double>("3.14159"));
+  }
+}
+
+void BM_ConvertVectorDouble(benchmark::State& state)
+{
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(
+        BT::convertFromString<std::vector<double>>("1.5;2.5;-3.25;4;5e-3"));
+  }
+}
+
+void BM_ConvertDoubleFailure(benchmark::State& state)
+{
+  for(auto _ : state)
+  {
+    try
+    {
+      benchmark::DoNotOptimize(BT::convertFromString<double>("not_a_number"));
+    }
+    catch(const BT::RuntimeError& err)
+    {
+      benchmark::DoNotOptimize(err.what());
+    }
+  }
+}
+
+void BM_TryConvertDoubleFailure(benchmark::State& state)
+{
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(BT::tryConvertFromString<double>("not_a_number"));
+  }
+}
+
+void BM_AnyStringToDouble(benchmark::State& state)
+{
+  const BT::Any any(std::string("123.5"));
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(any.tryCast<double>());
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_ConvertInt);
+BENCHMARK(BM_ConvertDouble);
+BENCHMARK(BM_ConvertVectorDouble);
+BENCHMARK(BM_ConvertDoubleFailure);
+BENCHMARK(BM_TryConvertDoubleFailure);
+BENCHMARK(BM_AnyStringToDouble);
@@ -0,0 +1,80 @@
+#include "test_helper.hpp"
+
+#include <benchmark/benchmark.h>
+
+// Routing on a mode string with 40 values: a single Dispatch node against
+// a chain of nested Switch6 (each one has the next Switch6 as default).
+// The argument is the index of the selected mode; 40 selects the default.
+
+namespace
+{
+constexpr int kNumModes = 40;
+
+std::string ModeName(int index)
+{
+  return "mode_" + std::to_string(index);
+}
+
+std::string DispatchTree()
+{
+  std::string xml = R"(<Dispatch variable="{mode}" cases=")";
+  for(int i = 0; i < kNumModes; i++)
+  {
+    xml += (i > 0 ? ";" : "") + ModeName(i);
+  }
+  xml += R"(">)";
+  for(int i = 0; i <= kNumModes; i++)
+  {
+    xml += "<AlwaysSuccess/>";
+  }
+  return xml + "</Dispatch>";
+}
+
+std::string NestedSwitchTree(int first)
+{
+  const int count = std::min(6, kNumModes - first);
+  if(count <= 0)
+  {
+    return "<AlwaysSuccess/>";
+  }
+  const std::string id = "Switch" + std::to_string(std::max(count, 2));
+  std::string xml = "<" + id + R"( variable="{mode}")";
+  for(int i = 0; i < std::max(count, 2); i++)
+  {
+    // a Switch2 with a single mode left uses an impossible value
+    const std::string value = (i < count) ? ModeName(first + i) : "-";
+    xml += " case_" + std::to_string(i + 1) + "=\"" + value + "\"";
+  }
+  xml += ">";
+  for(int i = 0; i < std::max(count, 2); i++)
+  {
+    xml += "<AlwaysSuccess/>";
+  }
+  return xml + NestedSwitchTree(first + count) + "</" + id + ">";
+}
+
+void RunTree(benchmark::State& state, const std::string& body)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateTreeFromBody(factory, body);
+  tree.rootBlackboard()->set("mode", ModeName(int(state.range(0))));
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(tree.tickOnce());
+  }
+}
+
+void BM_Dispatch(benchmark::State& state)
+{
+  RunTree(state, DispatchTree());
+}
+
+void BM_NestedSwitch6(benchmark::State& state)
+{
+  RunTree(state, NestedSwitchTree(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_Dispatch)->Arg(0)->Arg(20)->Arg(39)->Arg(kNumModes);
+BENCHMARK(BM_NestedSwitch6)->Arg(0)->Arg(20)->Arg(39)->Arg(kNumModes);
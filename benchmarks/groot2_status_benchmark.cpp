@@ -0,0 +1,188 @@
+#include "behaviortree_cpp/bt_factory.h"
+#include "behaviortree_cpp/loggers/groot2_publisher.h"
+
+#include "zmq_addon.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+// Compare the size and the round-trip time of STATUS (full buffer) and
+// STATUS_DELTA requests, on a large tree where only a few nodes change
+// between two consecutive requests.
+// Also measure the overhead of the publisher on the tick thread and the
+// cost of BLACKBOARD and BLACKBOARD_DELTA on a large blackboard.
+
+namespace
+{
+constexpr unsigned kPort = 16670;
+
+BT::Tree CreateWideTree(BT::BehaviorTreeFactory& factory, int children)
+{
+  // Only the Fallback and its first child change status at each tick
+  std::string xml = R"(<root BTCPP_format="4"><BehaviorTree ID="MainTree"><Fallback>)";
+  for(int i = 0; i < children; i++)
+  {
+    xml += "<AlwaysSuccess/>";
+  }
+  xml += "</Fallback></BehaviorTree></root>";
+  return factory.createTreeFromText(xml);
+}
+
+BT::Tree CreateSequenceTree(BT::BehaviorTreeFactory& factory, int children)
+{
+  // All the nodes change status at each tick
+  std::string xml = R"(<root BTCPP_format="4"><BehaviorTree ID="MainTree"><Sequence>)";
+  for(int i = 0; i < children; i++)
+  {
+    xml += "<AlwaysSuccess/>";
+  }
+  xml += "</Sequence></BehaviorTree></root>";
+  return factory.createTreeFromText(xml);
+}
+
+class Client
+{
+public:
+  explicit Client(unsigned port) : socket_(context_, ZMQ_REQ)
+  {
+    socket_.set(zmq::sockopt::linger, 0);
+    socket_.connect("tcp://127.0.0.1:" + std::to_string(port));
+  }
+
+  std::string request(BT::Monitor::RequestType type, const std::string* payload = nullptr)
+  {
+    zmq::multipart_t request;
+    request.addstr(BT::Monitor::SerializeHeader(BT::Monitor::RequestHeader(type)));
+    if(payload != nullptr)
+    {
+      request.addstr(*payload);
+    }
+    request.send(socket_);
+    zmq::multipart_t reply;
+    reply.recv(socket_);
+    return reply[1].to_string();
+  }
+
+private:
+  zmq::context_t context_;
+  zmq::socket_t socket_;
+};
+
+void BM_StatusFull(benchmark::State& state)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateWideTree(factory, int(state.range(0)));
+  BT::Groot2Publisher publisher(tree, kPort);
+  Client client(kPort);
+
+  size_t bytes = 0;
+  for(auto _ : state)
+  {
+    tree.tickOnce();
+    bytes += client.request(BT::Monitor::RequestType::STATUS).size();
+  }
+  state.counters["bytes_per_request"] =
+      benchmark::Counter(double(bytes), benchmark::Counter::kAvgIterations);
+}
+
+void BM_StatusDelta(benchmark::State& state)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateWideTree(factory, int(state.range(0)));
+  BT::Groot2Publisher publisher(tree, kPort);
+  Client client(kPort);
+
+  uint64_t sequence = 0;
+  size_t bytes = 0;
+  for(auto _ : state)
+  {
+    tree.tickOnce();
+    const auto payload = BT::Monitor::SerializeStatusDeltaRequest(sequence);
+    const auto reply = client.request(BT::Monitor::RequestType::STATUS_DELTA, &payload);
+    sequence = BT::Monitor::DeserializeStatusDeltaHeader(reply).sequence;
+    bytes += reply.size();
+  }
+  state.counters["bytes_per_request"] =
+      benchmark::Counter(double(bytes), benchmark::Counter::kAvgIterations);
+}
+
+void BM_TickWithoutPublisher(benchmark::State& state)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateSequenceTree(factory, int(state.range(0)));
+  for(auto _ : state)
+  {
+    tree.tickOnce();
+  }
+}
+
+void BM_TickWithPublisher(benchmark::State& state)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateSequenceTree(factory, int(state.range(0)));
+  BT::Groot2Publisher publisher(tree, kPort);
+  for(auto _ : state)
+  {
+    tree.tickOnce();
+  }
+}
+
+BT::Tree CreateTreeWithLargeBlackboard(BT::BehaviorTreeFactory& factory)
+{
+  auto blackboard = BT::Blackboard::create();
+  blackboard->set("path", std::vector<double>(100000, 1.0));
+  for(int i = 0; i < 100; i++)
+  {
+    blackboard->set("value_" + std::to_string(i), i);
+  }
+  return factory.createTreeFromText(R"(<root BTCPP_format="4">
+    <BehaviorTree ID="MainTree"><AlwaysSuccess/></BehaviorTree></root>)",
+                                    blackboard);
+}
+
+void BM_BlackboardFull(benchmark::State& state)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateTreeWithLargeBlackboard(factory);
+  BT::Groot2Publisher publisher(tree, kPort);
+  Client client(kPort);
+  const std::string payload = "MainTree";
+  for(auto _ : state)
+  {
+    tree.rootBlackboard()->set("value_0", int(state.iterations()));
+    benchmark::DoNotOptimize(client.request(BT::Monitor::RequestType::BLACKBOARD, &payload));
+  }
+}
+
+void BM_BlackboardDelta(benchmark::State& state)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateTreeWithLargeBlackboard(factory);
+  BT::Groot2Publisher publisher(tree, kPort);
+  Client client(kPort);
+  // the first request sends the whole blackboard
+  auto payload = BT::Monitor::SerializeBlackboardDeltaRequest("MainTree", 0);
+  client.request(BT::Monitor::RequestType::BLACKBOARD_DELTA, &payload);
+  for(auto _ : state)
+  {
+    // emulate a client that received everything until now: the sequence is
+    // the steady_clock time, in nanoseconds
+    const auto acknowledged = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch());
+    tree.rootBlackboard()->set("value_0", int(state.iterations()));
+    payload = BT::Monitor::SerializeBlackboardDeltaRequest("MainTree",
+                                                           uint64_t(acknowledged.count()));
+    benchmark::DoNotOptimize(
+        client.request(BT::Monitor::RequestType::BLACKBOARD_DELTA, &payload));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_StatusFull)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StatusDelta)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TickWithoutPublisher)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TickWithPublisher)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BlackboardFull)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BlackboardDelta)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,78 @@
+#include "behaviortree_cpp/bt_factory.h"
+#include "behaviortree_cpp/decorators/loop_node.h"
+
+#include <benchmark/benchmark.h>
+
+// Cost of consuming a queue of N integers with a LoopInt, whose child
+// sums them:
+//
+// - Value: one element at a time, through the port "value".
+// - Batch: 64 elements at a time, through the port "batch".
+
+namespace
+{
+constexpr int kBatchSize = 64;
+
+void RunTree(benchmark::State& state, bool batch)
+{
+  BT::BehaviorTreeFactory factory;
+  int64_t sum = 0;
+  factory.registerSimpleAction(
+      "SumValue",
+      [&sum](BT::TreeNode& node) {
+        sum += node.getInput<int>("value").value();
+        return BT::NodeStatus::SUCCESS;
+      },
+      { BT::InputPort<int>("value") });
+  factory.registerSimpleAction(
+      "SumBatch",
+      [&sum](BT::TreeNode& node) {
+        for(int value : *node.getInput<BT::SharedBatch<int>>("batch").value())
+        {
+          sum += value;
+        }
+        return BT::NodeStatus::SUCCESS;
+      },
+      { BT::InputPort<BT::SharedBatch<int>>("batch") });
+
+  std::string xml = R"(<root BTCPP_format="4"><BehaviorTree ID="MainTree">)";
+  xml += batch ? R"(<LoopInt queue="{queue}" batch_size=")" +
+                     std::to_string(kBatchSize) +
+                     R"(" batch="{batch}"><SumBatch batch="{batch}"/></LoopInt>)" :
+                 R"(<LoopInt queue="{queue}" value="{value}"><SumValue value="{value}"/></LoopInt>)";
+  xml += "</BehaviorTree></root>";
+  auto tree = factory.createTreeFromText(xml);
+
+  for(auto _ : state)
+  {
+    state.PauseTiming();
+    auto queue = std::make_shared<std::deque<int>>();
+    for(int i = 0; i < state.range(0); i++)
+    {
+      queue->push_back(i);
+    }
+    tree.rootBlackboard()->set("queue", queue);
+    state.ResumeTiming();
+
+    while(tree.tickOnce() == BT::NodeStatus::RUNNING)
+    {
+    }
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+void BM_Loop_Value(benchmark::State& state)
+{
+  RunTree(state, false);
+}
+
+void BM_Loop_Batch(benchmark::State& state)
+{
+  RunTree(state, true);
+}
+
+}  // namespace
+
+BENCHMARK(BM_Loop_Value)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Loop_Batch)->Arg(1024)->Arg(16384);
@@ -0,0 +1,63 @@
+#include "test_helper.hpp"
+
+#include <benchmark/benchmark.h>
+
+// Cost of ticking wide Parallel and ParallelAll nodes, with N children:
+//
+// - AllSucceed: every child succeeds immediately; the node completes and
+//   resets its state at each tick.
+// - HalfRunning: the even children succeed, the odd ones keep running;
+//   the completed children are skipped at every tick.
+
+namespace
+{
+BT::Tree CreateTree(BT::BehaviorTreeFactory& factory, const std::string& parallel,
+                    int children, bool half_running)
+{
+  std::string body = parallel;
+  for(int i = 0; i < children; i++)
+  {
+    body += (half_running && (i % 2 == 1)) ? "<KeepRunning/>" : "<AlwaysSuccess/>";
+  }
+  body += parallel.substr(0, parallel.find(' ')).replace(0, 1, "</") + ">";
+  return CreateTreeFromBody(factory, body);
+}
+
+void RunTree(benchmark::State& state, const std::string& parallel, bool half_running)
+{
+  BT::BehaviorTreeFactory factory;
+  factory.registerNodeType<KeepRunningAction>("KeepRunning");
+  auto tree = CreateTree(factory, parallel, int(state.range(0)), half_running);
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(tree.tickOnce());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+void BM_Parallel_AllSucceed(benchmark::State& state)
+{
+  RunTree(state, R"(<Parallel success_count="-1" failure_count="1">)", false);
+}
+
+void BM_Parallel_HalfRunning(benchmark::State& state)
+{
+  RunTree(state, R"(<Parallel success_count="-1" failure_count="1">)", true);
+}
+
+void BM_ParallelAll_AllSucceed(benchmark::State& state)
+{
+  RunTree(state, R"(<ParallelAll max_failures="1">)", false);
+}
+
+void BM_ParallelAll_HalfRunning(benchmark::State& state)
+{
+  RunTree(state, R"(<ParallelAll max_failures="1">)", true);
+}
+
+}  // namespace
+
+BENCHMARK(BM_Parallel_AllSucceed)->Arg(64)->Arg(512);
+BENCHMARK(BM_Parallel_HalfRunning)->Arg(64)->Arg(512);
+BENCHMARK(BM_ParallelAll_AllSucceed)->Arg(64)->Arg(512);
+BENCHMARK(BM_ParallelAll_HalfRunning)->Arg(64)->Arg(512);
@@ -0,0 +1,66 @@
+#include "test_helper.hpp"
+
+#include <benchmark/benchmark.h>
+
+// Cost of ticking a ReactiveSequence with N conditions, reading a blackboard
+// entry that is never updated, followed by an action that keeps running.
+// With incremental="true" the conditions are ticked only once.
+
+namespace
+{
+class IsPositive : public BT::ConditionNode
+{
+public:
+  IsPositive(const std::string& name, const BT::NodeConfig& config)
+    : BT::ConditionNode(name, config)
+  {}
+
+  static BT::PortsList providedPorts()
+  {
+    return { BT::InputPort<int>("value") };
+  }
+
+  BT::NodeStatus tick() override
+  {
+    return (getInput<int>("value").value() > 0) ? BT::NodeStatus::SUCCESS :
+                                                  BT::NodeStatus::FAILURE;
+  }
+};
+
+void RunTree(benchmark::State& state, bool incremental)
+{
+  BT::BehaviorTreeFactory factory;
+  factory.registerNodeType<KeepRunningAction>("KeepRunning");
+  factory.registerNodeType<IsPositive>("IsPositive");
+
+  std::string body =
+      incremental ? R"(<ReactiveSequence incremental="true">)" : "<ReactiveSequence>";
+  for(int i = 0; i < state.range(0); i++)
+  {
+    body += R"(<IsPositive value="{value}"/>)";
+  }
+  body += "<KeepRunning/></ReactiveSequence>";
+
+  auto tree = CreateTreeFromBody(factory, body);
+  tree.rootBlackboard()->set("value", 42);
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(tree.tickOnce());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+void BM_ReactiveSequence_Full(benchmark::State& state)
+{
+  RunTree(state, false);
+}
+
+void BM_ReactiveSequence_Incremental(benchmark::State& state)
+{
+  RunTree(state, true);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ReactiveSequence_Full)->Arg(8)->Arg(64);
+BENCHMARK(BM_ReactiveSequence_Incremental)->Arg(8)->Arg(64);
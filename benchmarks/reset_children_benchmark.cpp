@@ -0,0 +1,83 @@
+#include "test_helper.hpp"
+
+#include <benchmark/benchmark.h>
+
+// Cost of halting and resetting the children of control nodes, that are
+// mostly IDLE already:
+//
+// - Wide: a ReactiveSequence with an action that keeps running, followed by
+//   N siblings; at each tick, all the siblings of the action are halted.
+// - Deep: N nested ReactiveSequences, each one with the next level and two
+//   more siblings as children; the innermost action keeps running.
+// - Halt: a Sequence with an action that keeps running, followed by N
+//   siblings, is halted and ticked again.
+
+namespace
+{
+void BM_ResetChildren_Wide(benchmark::State& state)
+{
+  std::string body = "<ReactiveSequence><KeepRunning/>";
+  for(int i = 0; i < state.range(0); i++)
+  {
+    body += "<AlwaysSuccess/>";
+  }
+  body += "</ReactiveSequence>";
+
+  BT::BehaviorTreeFactory factory;
+  factory.registerNodeType<KeepRunningAction>("KeepRunning");
+  auto tree = CreateTreeFromBody(factory, body);
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(tree.tickOnce());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+void BM_ResetChildren_Deep(benchmark::State& state)
+{
+  std::string body;
+  for(int i = 0; i < state.range(0); i++)
+  {
+    body += "<ReactiveSequence>";
+  }
+  body += "<KeepRunning/>";
+  for(int i = 0; i < state.range(0); i++)
+  {
+    body += "<AlwaysSuccess/><AlwaysSuccess/></ReactiveSequence>";
+  }
+
+  BT::BehaviorTreeFactory factory;
+  factory.registerNodeType<KeepRunningAction>("KeepRunning");
+  auto tree = CreateTreeFromBody(factory, body);
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(tree.tickOnce());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+void BM_ResetChildren_Halt(benchmark::State& state)
+{
+  std::string body = "<Sequence><KeepRunning/>";
+  for(int i = 0; i < state.range(0); i++)
+  {
+    body += "<AlwaysSuccess/>";
+  }
+  body += "</Sequence>";
+
+  BT::BehaviorTreeFactory factory;
+  factory.registerNodeType<KeepRunningAction>("KeepRunning");
+  auto tree = CreateTreeFromBody(factory, body);
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(tree.tickOnce());
+    tree.haltTree();
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ResetChildren_Wide)->Arg(16)->Arg(256);
+BENCHMARK(BM_ResetChildren_Deep)->Arg(16)->Arg(64);
+BENCHMARK(BM_ResetChildren_Halt)->Arg(16)->Arg(256);
@@ -0,0 +1,67 @@
+#include "behaviortree_cpp/bt_factory.h"
+
+#include <benchmark/benchmark.h>
+
+// Cost of ticking a Switch6 in a tight loop, when the variable matches
+// the last case (all the cases are compared) or none of them (default).
+// The variable is a blackboard entry, the cases are literals; in EnumLastCase
+// they are compared as numbers.
+
+namespace
+{
+void RunSwitch(benchmark::State& state, const std::string& variable_xml,
+               const std::string& variable)
+{
+  BT::BehaviorTreeFactory factory;
+  factory.registerScriptingEnums<BT::NodeStatus>();
+  const std::string xml = R"(<root BTCPP_format="4"><BehaviorTree ID="MainTree">)"
+                          "<Switch6 variable=\"{var}\" " +
+                          variable_xml +
+                          R"(>
+        <AlwaysSuccess/><AlwaysSuccess/><AlwaysSuccess/>
+        <AlwaysSuccess/><AlwaysSuccess/><AlwaysSuccess/>
+        <AlwaysSuccess/>
+      </Switch6></BehaviorTree></root>)";
+  auto tree = factory.createTreeFromText(xml);
+  tree.rootBlackboard()->set("var", variable);
+
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(tree.tickOnce());
+  }
+}
+
+const char* kIntCases = R"(case_1="1" case_2="2" case_3="3" case_4="4" case_5="5" case_6="6")";
+
+const char* kStringCases = R"(case_1="alpha" case_2="beta" case_3="gamma" )"
+                           R"(case_4="delta" case_5="epsilon" case_6="zeta")";
+
+const char* kEnumCases = R"(case_1="IDLE" case_2="RUNNING" case_3="SUCCESS" )"
+                         R"(case_4="FAILURE" case_5="SKIPPED" case_6="10")";
+
+void BM_Switch_IntLastCase(benchmark::State& state)
+{
+  RunSwitch(state, kIntCases, "6");
+}
+
+void BM_Switch_IntDefault(benchmark::State& state)
+{
+  RunSwitch(state, kIntCases, "42");
+}
+
+void BM_Switch_StringLastCase(benchmark::State& state)
+{
+  RunSwitch(state, kStringCases, "zeta");
+}
+
+void BM_Switch_EnumLastCase(benchmark::State& state)
+{
+  RunSwitch(state, kEnumCases, "10.0");
+}
+
+}  // namespace
+
+BENCHMARK(BM_Switch_IntLastCase);
+BENCHMARK(BM_Switch_IntDefault);
+BENCHMARK(BM_Switch_StringLastCase);
+BENCHMARK(BM_Switch_EnumLastCase);
@@ -0,0 +1,59 @@
+#include "test_helper.hpp"
+
+#include <benchmark/benchmark.h>
+
+// Cost of ticking a UtilitySelector with N children, each one with a score
+// reading its own blackboard entry; the best child keeps running.
+//
+// - Cached: the entries are never updated, the scores are evaluated once.
+// - OneUpdated: one entry is updated at each tick, only its score is
+//   evaluated again.
+
+namespace
+{
+void RunTree(benchmark::State& state, bool update)
+{
+  BT::BehaviorTreeFactory factory;
+  factory.registerNodeType<KeepRunningAction>("KeepRunning");
+
+  std::string scores;
+  std::string children;
+  for(int i = 0; i < state.range(0); i++)
+  {
+    scores += "value_" + std::to_string(i) + " * 2 + 1;";
+    children += "<KeepRunning/>";
+  }
+  auto tree = CreateTreeFromBody(factory, R"(<UtilitySelector scores=")" + scores +
+                                          R"(">)" + children + "</UtilitySelector>");
+
+  auto blackboard = tree.rootBlackboard();
+  for(int i = 0; i < state.range(0); i++)
+  {
+    blackboard->set("value_" + std::to_string(i), double(i));
+  }
+  const std::string updated_key = "value_0";
+  for(auto _ : state)
+  {
+    if(update)
+    {
+      blackboard->set(updated_key, 0.0);
+    }
+    benchmark::DoNotOptimize(tree.tickOnce());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+void BM_UtilitySelector_Cached(benchmark::State& state)
+{
+  RunTree(state, false);
+}
+
+void BM_UtilitySelector_OneUpdated(benchmark::State& state)
+{
+  RunTree(state, true);
+}
+
+}  // namespace
+
+BENCHMARK(BM_UtilitySelector_Cached)->Arg(16)->Arg(256);
+BENCHMARK(BM_UtilitySelector_OneUpdated)->Arg(16)->Arg(256);
@@ -62,6 +62,27 @@ bool StartWith(StringView str, StringView prefix);
 
 bool StartWith(StringView str, char prefix);
 
+namespace details
+{
+// Copy the key into a thread-local buffer, reused by all the lookups
+// of the calling thread.
+const std::string& LookupKey(StringView key);
+}  // namespace details
+
+/**
+ * @brief FindKey looks up a StringView in a map or unordered_map keyed by
+ * std::string (PortsList, PortsRemapping, etc.), without creating a
+ * temporary std::string for each call.
+ *
+ * Transparent lookup in unordered containers is not available in C++17.
+ */
+template <typename Map>
+[[nodiscard]] inline auto FindKey(Map& map, StringView key)
+    -> decltype(map.find(std::declval<const std::string&>()))
+{
+  return map.find(details::LookupKey(key));
+}
+
 // vector of key/value pairs
 using KeyValueVector = std::vector<std::pair<std::string, std::string>>;
 
@@ -224,6 +245,84 @@ template <>
 template <>
 [[nodiscard]] PortDirection convertFromString<PortDirection>(StringView str);
 
+/**
+ * @brief tryConvertFromString is the same as convertFromString, but it returns
+ * an error instead of throwing an exception.
+ *
+ * Numbers, bool and vectors of them are parsed with std::from_chars, without
+ * exceptions or temporary allocations, even when the conversion fails.
+ * Any other type falls back to convertFromString<T>().
+ */
+template <typename T>
+[[nodiscard]] inline Expected<T> tryConvertFromString(StringView str)
+{
+  try
+  {
+    return convertFromString<T>(str);
+  }
+  catch(std::exception& ex)
+  {
+    return nonstd::make_unexpected(ex.what());
+  }
+}
+
+template <>
+[[nodiscard]] Expected<int8_t> tryConvertFromString<int8_t>(StringView str);
+
+template <>
+[[nodiscard]] Expected<int16_t> tryConvertFromString<int16_t>(StringView str);
+
+template <>
+[[nodiscard]] Expected<int32_t> tryConvertFromString<int32_t>(StringView str);
+
+template <>
+[[nodiscard]] Expected<int64_t> tryConvertFromString<int64_t>(StringView str);
+
+template <>
+[[nodiscard]] Expected<uint8_t> tryConvertFromString<uint8_t>(StringView str);
+
+template <>
+[[nodiscard]] Expected<uint16_t> tryConvertFromString<uint16_t>(StringView str);
+
+template <>
+[[nodiscard]] Expected<uint32_t> tryConvertFromString<uint32_t>(StringView str);
+
+template <>
+[[nodiscard]] Expected<uint64_t> tryConvertFromString<uint64_t>(StringView str);
+
+template <>
+[[nodiscard]] Expected<float> tryConvertFromString<float>(StringView str);
+
+template <>
+[[nodiscard]] Expected<double> tryConvertFromString<double>(StringView str);
+
+template <>
+[[nodiscard]] Expected<bool> tryConvertFromString<bool>(StringView str);
+
+template <>
+[[nodiscard]] Expected<std::vector<int>>
+tryConvertFromString<std::vector<int>>(StringView str);
+
+template <>
+[[nodiscard]] Expected<std::vector<double>>
+tryConvertFromString<std::vector<double>>(StringView str);
+
+template <>
+[[nodiscard]] Expected<std::vector<bool>>
+tryConvertFromString<std::vector<bool>>(StringView str);
+
+/// True if tryConvertFromString<T> is one of the specializations above,
+/// that never throw.
+template <typename T>
+inline constexpr bool HasNoThrowStringConversion =
+    std::is_same_v<T, int8_t> || std::is_same_v<T, int16_t> ||
+    std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t> ||
+    std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> ||
+    std::is_same_v<T, uint32_t> || std::is_same_v<T, uint64_t> ||
+    std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_same_v<T, bool> ||
+    std::is_same_v<T, std::vector<int>> || std::is_same_v<T, std::vector<double>> ||
+    std::is_same_v<T, std::vector<bool>>;
+
 using StringConverter = std::function<Any(StringView)>;
 
 using StringConvertersMap = std::unordered_map<const std::type_info*, StringConverter>;
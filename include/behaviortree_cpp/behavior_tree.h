@@ -24,6 +24,8 @@
 #include "behaviortree_cpp/actions/unset_blackboard_node.h"
 #include "behaviortree_cpp/actions/updated_action.h"
 #include "behaviortree_cpp/condition_node.h"
+#include "behaviortree_cpp/controls/concurrent_parallel_node.h"
+#include "behaviortree_cpp/controls/dispatch_node.h"
 #include "behaviortree_cpp/controls/fallback_node.h"
 #include "behaviortree_cpp/controls/if_then_else_node.h"
 #include "behaviortree_cpp/controls/parallel_all_node.h"
@@ -34,6 +36,7 @@
 #include "behaviortree_cpp/controls/sequence_with_memory_node.h"
 #include "behaviortree_cpp/controls/switch_node.h"
 #include "behaviortree_cpp/controls/try_catch_node.h"
+#include "behaviortree_cpp/controls/utility_selector_node.h"
 #include "behaviortree_cpp/controls/while_do_else_node.h"
 #include "behaviortree_cpp/decorators/delay_node.h"
 #include "behaviortree_cpp/decorators/force_failure_node.h"
@@ -66,7 +69,7 @@ void applyRecursiveVisitor(TreeNode* root_node,
  */
 void printTreeRecursively(const TreeNode* root_node, std::ostream& stream = std::cout);
 
-using SerializedTreeStatus = std::vector<std::pair<uint16_t, uint8_t>>;
+using SerializedTreeStatus = std::vector<std::pair<uint32_t, uint8_t>>;
 
 /**
  * @brief buildSerializedStatusSnapshot can be used to create a buffer that can be stored
@@ -7,11 +7,13 @@
 #include "behaviortree_cpp/utils/polymorphic_cast_registry.hpp"
 #include "behaviortree_cpp/utils/safe_any.hpp"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace BT
 {
@@ -38,7 +40,10 @@ public:
 
 protected:
   // This is intentionally protected. Use Blackboard::create instead
-  Blackboard(Blackboard::Ptr parent) : parent_bb_(parent)
+  Blackboard(Blackboard::Ptr parent)
+    : parent_bb_(parent)
+    , generation_(parent ? parent->generation_ :
+                           std::make_shared<std::atomic<uint64_t>>(0))
   {}
 
 public:
@@ -58,6 +63,23 @@ public:
     // timestamp since epoch
     std::chrono::nanoseconds stamp = std::chrono::nanoseconds{ 0 };
 
+    // Immutable copy of value, shared by the readers until the next write.
+    // See Blackboard::getSnapshot()
+    std::shared_ptr<const void> snapshot;
+    std::type_index snapshot_type = typeid(void);
+    const void* snapshot_converter = nullptr;
+    uint64_t snapshot_sequence_id = 0;
+
+    // Values parsed from a string entry, one for each type and converter
+    // it was read with. See Blackboard::getConverted()
+    struct ConvertedValue
+    {
+      const void* converter = nullptr;
+      linb::any value;
+    };
+    std::vector<ConvertedValue> converted_values;
+    uint64_t converted_sequence_id = 0;
+
     Entry(const TypeInfo& _info) : info(_info)
     {}
 
@@ -76,17 +98,24 @@ public:
     return std::shared_ptr<Blackboard>(new Blackboard(parent));
   }
 
-  virtual ~Blackboard() = default;
+  virtual ~Blackboard()
+  {
+    // the children may have found some of our entries through remapping
+    invalidateRemappedEntries();
+  }
 
   void enableAutoRemapping(bool remapping);
 
-  [[nodiscard]] const std::shared_ptr<Entry> getEntry(const std::string& key) const;
+  [[nodiscard]] const std::shared_ptr<Entry> getEntry(StringView key) const;
 
-  [[nodiscard]] std::shared_ptr<Blackboard::Entry> getEntry(const std::string& key);
+  [[nodiscard]] std::shared_ptr<Blackboard::Entry> getEntry(StringView key);
 
-  [[nodiscard]] AnyPtrLocked getAnyLocked(const std::string& key);
+  /// The value may be modified through the returned pointer: the snapshot
+  /// and the converted values of the entry are discarded.
+  [[nodiscard]] AnyPtrLocked getAnyLocked(StringView key);
 
-  [[nodiscard]] AnyPtrLocked getAnyLocked(const std::string& key) const;
+  /// Read-only access: the value must not be modified through the returned pointer.
+  [[nodiscard]] AnyPtrLocked getAnyLocked(StringView key) const;
 
   [[deprecated("Use getAnyLocked instead")]] const Any*
   getAny(const std::string& key) const;
@@ -97,27 +126,74 @@ public:
    *  Note that this method may throw an exception if the cast to T failed.
    */
   template <typename T>
-  [[nodiscard]] bool get(const std::string& key, T& value) const;
+  [[nodiscard]] bool get(StringView key, T& value) const;
 
   template <typename T>
-  [[nodiscard]] Expected<Timestamp> getStamped(const std::string& key, T& value) const;
+  [[nodiscard]] Expected<Timestamp> getStamped(StringView key, T& value) const;
 
   /**
    * Version of get() that throws if it fails.
    */
   template <typename T>
-  [[nodiscard]] T get(const std::string& key) const;
+  [[nodiscard]] T get(StringView key) const;
 
   template <typename T>
-  [[nodiscard]] Expected<StampedValue<T>> getStamped(const std::string& key) const;
+  [[nodiscard]] Expected<StampedValue<T>> getStamped(StringView key) const;
+
+  /**
+   * @brief getShared returns an immutable copy of the value, shared with
+   * the other readers: the value is copied at most once after each write,
+   * no matter how many times it is read.
+   *
+   * The snapshot remains valid after the entry is modified, and writers
+   * are not blocked by the readers that are still using it.
+   * Throws if the entry doesn't exist or the cast to T failed.
+   */
+  template <typename T>
+  [[nodiscard]] std::shared_ptr<const T> getShared(StringView key) const;
+
+  /**
+   * @brief getSnapshot returns the snapshot of the entry, creating it
+   * with convert(entry.value) if the value changed since it was created.
+   * converter_id identifies the StringConverter used by convert, if any
+   * (for instance, the address of the one in the PortInfo), or is nullptr.
+   * entry.entry_mutex must be locked by the caller.
+   */
+  template <typename T, typename Converter>
+  [[nodiscard]] static std::shared_ptr<const T>
+  getSnapshot(Entry& entry, const void* converter_id, const Converter& convert);
+
+  /**
+   * @brief getConverted returns the string stored in the entry converted to T,
+   * with convert(str). The result is memoized until the entry is modified,
+   * so that reading an unchanged string repeatedly costs a single parsing.
+   * Values converted with different converter_id are memoized separately,
+   * see getSnapshot().
+   * entry.entry_mutex must be locked by the caller.
+   */
+  template <typename T, typename Converter>
+  [[nodiscard]] static Expected<T> getConverted(Entry& entry, const void* converter_id,
+                                                const Converter& convert);
 
   /// Update the entry with the given key
   template <typename T>
-  void set(const std::string& key, const T& value);
+  void set(StringView key, const T& value);
+
+  /// Same as set(key, value), but the value is moved into the entry,
+  /// instead of being copied. Used for custom types passed as rvalue.
+  template <typename T, typename = std::enable_if_t<is_movable_into_any<T>::value>>
+  void set(StringView key, T&& value);
+
+  /// Construct the value with the given arguments and move it into the entry.
+  template <typename T, typename... Args>
+  void emplace(StringView key, Args&&... args)
+  {
+    set(key, T(std::forward<Args>(args)...));
+  }
 
   void unset(const std::string& key);
 
-  [[nodiscard]] const TypeInfo* entryInfo(const std::string& key);
+  [[nodiscard]] const TypeInfo* entryInfo(StringView key);
 
   void addSubtreeRemapping(StringView internal, StringView external);
 
@@ -182,6 +258,23 @@ private:
   std::weak_ptr<Blackboard> parent_bb_;
   std::unordered_map<std::string, std::string> internal_to_external_;
 
+  struct RemappedEntry
+  {
+    std::shared_ptr<Entry> entry;
+    uint64_t generation = 0;
+  };
+  // Entries of the parent blackboards found by getEntry(), through remapping
+  // or "@". Valid only if generation is equal to the current generation_.
+  mutable std::unordered_map<std::string, RemappedEntry> remapped_entries_;
+
+  // Shared by all the blackboards of the hierarchy. Incremented when an
+  // entry is created or removed, or when the remapping changes, in any of them.
+  std::shared_ptr<std::atomic<uint64_t>> generation_;
+
+  void invalidateRemappedEntries();
+
+  std::shared_ptr<Entry> findRemappedEntry(StringView key) const;
+
   std::shared_ptr<Entry> createEntryImpl(const std::string& key, const TypeInfo& info);
 
   bool autoremapping_ = false;
@@ -233,7 +326,7 @@ inline Expected<T> Blackboard::tryCastWithPolymorphicFallback(const Any* any) co
 }
 
 template <typename T>
-inline T Blackboard::get(const std::string& key) const
+inline T Blackboard::get(StringView key) const
 {
   if(auto any_ref = getAnyLocked(key))
   {
@@ -253,6 +346,75 @@ inline T Blackboard::get(const std::string& key) const
   throw RuntimeError("Blackboard::get() error. Missing key [", key, "]");
 }
 
+template <typename T, typename Converter>
+inline std::shared_ptr<const T>
+Blackboard::getSnapshot(Entry& entry, const void* converter_id, const Converter& convert)
+{
+  if(entry.snapshot && entry.snapshot_sequence_id == entry.sequence_id &&
+     entry.snapshot_type == typeid(T) && entry.snapshot_converter == converter_id)
+  {
+    return std::static_pointer_cast<const T>(entry.snapshot);
+  }
+  auto snapshot = std::make_shared<const T>(convert(entry.value));
+  entry.snapshot = snapshot;
+  entry.snapshot_type = typeid(T);
+  entry.snapshot_converter = converter_id;
+  entry.snapshot_sequence_id = entry.sequence_id;
+  return snapshot;
+}
+
+template <typename T, typename Converter>
+inline Expected<T> Blackboard::getConverted(Entry& entry, const void* converter_id,
+                                            const Converter& convert)
+{
+  if(entry.converted_sequence_id != entry.sequence_id)
+  {
+    entry.converted_values.clear();
+    entry.converted_sequence_id = entry.sequence_id;
+  }
+  for(const auto& converted : entry.converted_values)
+  {
+    if(converted.converter != converter_id)
+    {
+      continue;
+    }
+    if(const T* value = linb::any_cast<T>(&converted.value))
+    {
+      return *value;
+    }
+  }
+  const auto* str = entry.value.castPtr<SafeAny::SimpleString>();
+  Expected<T> value = convert(StringView(str->data(), str->size()));
+  if(value)
+  {
+    entry.converted_values.push_back({ converter_id, linb::any(value.value()) });
+  }
+  return value;
+}
+
+template <typename T>
+inline std::shared_ptr<const T> Blackboard::getShared(StringView key) const
+{
+  if(auto entry = getEntry(key))
+  {
+    std::scoped_lock lk(entry->entry_mutex);
+    if(entry->value.empty())
+    {
+      throw RuntimeError("Blackboard::getShared() error. Entry [", key,
+                         "] hasn't been initialized, yet");
+    }
+    return getSnapshot<T>(*entry, nullptr, [this](const Any& any) -> T {
+      auto result = tryCastWithPolymorphicFallback<T>(&any);
+      if(!result)
+      {
+        throw std::runtime_error(result.error());
+      }
+      return std::move(result.value());
+    });
+  }
+  throw RuntimeError("Blackboard::getShared() error. Missing key [", key, "]");
+}
+
 inline void Blackboard::unset(const std::string& key)
 {
   std::unique_lock storage_lock(storage_mutex_);
@@ -266,36 +428,34 @@ inline void Blackboard::unset(const std::string& key)
   }
 
   storage_.erase(it);
+  invalidateRemappedEntries();
 }
 
 template <typename T>
-inline void Blackboard::set(const std::string& key, const T& value)
+inline void Blackboard::set(StringView key, const T& value)
 {
-  if(StartWith(key, '@'))
-  {
-    rootBlackboard()->set(key.substr(1, key.size() - 1), value);
-    return;
-  }
-  std::shared_lock storage_lock(storage_mutex_);
-
-  // check local storage
-  auto it = storage_.find(key);
-  if(it == storage_.end())
+  // check local storage and the remapped entries of the parent blackboards
+  auto entry_ptr = getEntry(key);
+  if(!entry_ptr)
   {
+    if(StartWith(key, '@'))
+    {
+      rootBlackboard()->set(key.substr(1, key.size() - 1), value);
+      return;
+    }
     // create a new entry
     Any new_value(value);
-    storage_lock.unlock();
     std::shared_ptr<Blackboard::Entry> entry;
     // if a new generic port is created with a string, it's type should be AnyTypeAllowed
     if constexpr(std::is_same_v<std::string, T>)
     {
-      entry = createEntryImpl(key, PortInfo(PortDirection::INOUT));
+      entry = createEntryImpl(std::string(key), PortInfo(PortDirection::INOUT));
     }
     else
     {
       PortInfo new_port(PortDirection::INOUT, new_value.type(),
                         GetAnyFromStringFunctor<T>());
-      entry = createEntryImpl(key, new_port);
+      entry = createEntryImpl(std::string(key), new_port);
     }
 
     // Lock entry_mutex before writing to prevent data races with
@@ -309,10 +469,8 @@ inline void Blackboard::set(const std::string& key, const T& value)
   {
     // this is not the first time we set this entry, we need to check
     // if the type is the same or not.
-    // Copy shared_ptr to prevent use-after-free if another thread
-    // calls unset() while we hold the reference (BUG-2 fix).
-    auto entry_ptr = it->second;
-    storage_lock.unlock();
+    // entry_ptr is a copy of the shared_ptr, to prevent use-after-free if
+    // another thread calls unset() while we hold the reference (BUG-2 fix).
     Entry& entry = *entry_ptr;
 
     std::scoped_lock scoped_lock(entry.entry_mutex);
@@ -378,15 +536,52 @@ inline void Blackboard::set(const std::string& key, const T& value)
     else
     {
       // copy only if the type is compatible
-      new_value.copyInto(previous_any);
+      new_value.moveInto(previous_any);
     }
     entry.sequence_id++;
     entry.stamp = std::chrono::steady_clock::now().time_since_epoch();
   }
 }
 
+template <typename T, typename>
+inline void Blackboard::set(StringView key, T&& value)
+{
+  // Copy of the shared_ptr, to prevent use-after-free if another thread
+  // calls unset() while we hold the reference (BUG-2 fix).
+  auto entry = getEntry(key);
+  if(!entry)
+  {
+    if(StartWith(key, '@'))
+    {
+      rootBlackboard()->set(key.substr(1, key.size() - 1), std::move(value));
+      return;
+    }
+    entry = createEntryImpl(std::string(key), PortInfo(PortDirection::INOUT, typeid(T),
+                                                       GetAnyFromStringFunctor<T>()));
+  }
+
+  std::scoped_lock entry_lock(entry->entry_mutex);
+  if(!entry->info.isStronglyTyped())
+  {
+    entry->info = TypeInfo::Create<T>();
+  }
+  else if(entry->info.type() != std::type_index(typeid(T)))
+  {
+    debugMessage();
+    throw LogicError(StrCat("Blackboard::set(", key,
+                            "): once declared, "
+                            "the type of a port shall not change. "
+                            "Previously declared type [",
+                            BT::demangle(entry->info.type()), "], current type [",
+                            BT::demangle(typeid(T)), "]"));
+  }
+  entry->value = Any(std::move(value));
+  entry->sequence_id++;
+  entry->stamp = std::chrono::steady_clock::now().time_since_epoch();
+}
+
 template <typename T>
-inline bool Blackboard::get(const std::string& key, T& value) const
+inline bool Blackboard::get(StringView key, T& value) const
 {
   if(auto any_ref = getAnyLocked(key))
   {
@@ -407,7 +602,7 @@ inline bool Blackboard::get(const std::string& key, T& value) const
 }
 
 template <typename T>
-inline Expected<Timestamp> Blackboard::getStamped(const std::string& key, T& value) const
+inline Expected<Timestamp> Blackboard::getStamped(StringView key, T& value) const
 {
   if(auto entry = getEntry(key))
   {
@@ -430,7 +625,7 @@ inline Expected<Timestamp> Blackboard::getStamped(const std::string& key, T& val
 }
 
 template <typename T>
-inline Expected<StampedValue<T>> Blackboard::getStamped(const std::string& key) const
+inline Expected<StampedValue<T>> Blackboard::getStamped(StringView key) const
 {
   StampedValue<T> out;
   if(auto res = getStamped<T>(key, out.value))
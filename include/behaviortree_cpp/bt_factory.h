@@ -145,6 +145,20 @@ public:
    */
   [[nodiscard]] std::shared_ptr<WakeUpSignal> wakeUpSignal() const;
 
+  /**
+   * @brief Change the clock of the tree (by default, Clock::realTime()).
+   *
+   * With a SimulatedClock, sleep() and tickWhileRunning() advance its time
+   * instead of waiting, and the built-in nodes using timers (Sleep, Delay,
+   * Timeout and TestNode) follow it. tickWhileRunning(0ms) jumps directly from
+   * one timer to the next, while tickOnce() never advances the time.
+   *
+   * It should be called before the first tick, and before creating the loggers.
+   */
+  void setClock(std::shared_ptr<Clock> clock);
+
+  [[nodiscard]] const std::shared_ptr<Clock>& clock() const;
+
   ~Tree();
 
   /// Tick the root of the tree once, even if a node invoked
@@ -158,6 +172,16 @@ public:
    */
   NodeStatus tickOnce();
 
+  /**
+   * @brief Same as tickOnce(), but the tick is expected to be completed before
+   * the deadline: when it is reached, the Sequences and Fallbacks return RUNNING,
+   * instead of ticking their next child, and resume from it at the following tick.
+   *
+   * A node that is still executing when the deadline is reached can't be
+   * interrupted: this is recorded as an overrun, see deadlineOverruns().
+   */
+  NodeStatus tickOnceUntil(std::chrono::steady_clock::time_point deadline);
+
   /// Call tickOnce until the status is different from RUNNING.
   /// Note that between one tick and the following one,
   /// a Tree::sleep() is used
@@ -172,7 +196,24 @@ public:
   //Call the visitor for each node of the tree.
   void applyVisitor(const std::function<void(TreeNode*)>& visitor);
 
-  [[nodiscard]] uint16_t getUID();
+  [[nodiscard]] uint32_t getUID();
+
+  /**
+   * @brief nodeByUID returns the node with the given TreeNode::UID(), in O(1).
+   *
+   * UIDs are assigned by getUID() in order of creation, starting from 1:
+   * once the tree is created, they are dense in the range [1, N],
+   * where N is the number of nodes. Returns nullptr if there is no such node.
+   */
+  [[nodiscard]] TreeNode* nodeByUID(uint32_t uid) const;
+
+  /**
+   * @brief Number of times each node was executing when the deadline of
+   * tickOnceUntil() was reached, indexed by TreeNode::UID().
+   *
+   * Nodes with an UID greater or equal than the size of the vector never did.
+   */
+  [[nodiscard]] std::vector<uint64_t> deadlineOverruns() const;
 
   /// Get a list of nodes which fullPath() match a wildcard filter and
   /// a given path. Example:
@@ -205,6 +246,10 @@ private:
 
   std::shared_ptr<WakeUpSignal> wake_up_;
 
+  std::shared_ptr<TickDeadline> tick_deadline_;
+
+  std::shared_ptr<Clock> clock_ = Clock::realTime();
+
   enum TickOption
   {
     EXACTLY_ONCE,
@@ -219,7 +264,12 @@ private:
   // valid after the factory is destroyed.
   void remapManifestPointers();
 
-  uint16_t uid_counter_ = 0;
+  // rebuild nodes_by_uid_. Called by initialize()
+  void indexNodesByUID();
+
+  uint32_t uid_counter_ = 0;
+  // indexed by UID; the element 0 is always nullptr
+  std::vector<TreeNode*> nodes_by_uid_;
 };
 
 class Parser;
@@ -41,6 +41,14 @@
 // in order to disable functions working with the typeid of a type
 #endif
 
+// Size in bytes of the inline (small buffer) storage. Values that fit in it,
+// are nothrow-move-constructible and not over-aligned never touch the heap.
+// The original implementation uses two pointers (enough for a shared_ptr).
+// Every translation unit must agree on this value, since it changes the
+// layout of linb::any: it is defined by the header generated at build time
+// (CMake option BTCPP_ANY_INLINE_CAPACITY).
+#include "behaviortree_cpp/bt_config.h"
+
 
 namespace linb
 {
@@ -212,10 +220,15 @@ private: // Storage and Virtual Method Table
 
     union storage_union
     {
-        struct alignas(void*) stack_storage_t : std::array<std::byte, 2 * sizeof(void*)> {};
+        static_assert(BTCPP_ANY_INLINE_CAPACITY >= 2 * sizeof(void*),
+                      "BTCPP_ANY_INLINE_CAPACITY must hold at least two pointers");
+        static_assert(BTCPP_ANY_INLINE_CAPACITY % sizeof(void*) == 0,
+                      "BTCPP_ANY_INLINE_CAPACITY must be a multiple of sizeof(void*)");
+
+        struct alignas(void*) stack_storage_t : std::array<std::byte, BTCPP_ANY_INLINE_CAPACITY> {};
 
         void*               dynamic;
-        stack_storage_t     stack;      // 2 words for e.g. shared_ptr
+        stack_storage_t     stack;      // at least 2 words for e.g. shared_ptr
     };
 
     /// Base VTable specification.
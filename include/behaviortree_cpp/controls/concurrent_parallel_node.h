@@ -0,0 +1,61 @@
+#pragma once
+
+#include "behaviortree_cpp/controls/parallel_node.h"
+
+#include <memory>
+
+namespace BT
+{
+class ThreadPool;
+
+/**
+ * @brief The ConcurrentParallelNode has the same ports and the same
+ * semantic of the ParallelNode, but its children are ticked __in separate
+ * threads__, using ThreadPool::shared().
+ *
+ * At each tick, all the children that are not completed yet are ticked
+ * at the same time (one of them in the thread that ticks the tree) and
+ * the node waits for all of them before evaluating the thresholds.
+ * Differently from the ParallelNode, no child is skipped because a
+ * threshold was reached by a sibling during the same tick.
+ *
+ * It is useful when the tick() of the children is synchronous and
+ * expensive (for instance, CPU-heavy conditions): their latency
+ * doesn't add up anymore.
+ *
+ * Rules to follow:
+ *
+ * - The children can read and write the blackboard, that is thread-safe,
+ *   but the order of their accesses is undefined: two children should not
+ *   write the same entry and a child should not read an entry written by
+ *   a sibling, during the same tick.
+ * - Any state shared between the children, outside the blackboard, must be
+ *   protected by the user.
+ * - Loggers receive the status changes of the children from the worker threads.
+ * - halt() is always invoked by the thread that ticks the tree, when none
+ *   of the children is being ticked; the same applies to the children that
+ *   are halted because a threshold was reached.
+ * - If a child throws, the exception is rethrown by this node, once all
+ *   the other children completed their tick.
+ */
+class ConcurrentParallelNode : public ParallelNode
+{
+public:
+  ConcurrentParallelNode(const std::string& name, const NodeConfig& config);
+
+  ~ConcurrentParallelNode() override;
+
+  ConcurrentParallelNode(const ConcurrentParallelNode&) = delete;
+  ConcurrentParallelNode& operator=(const ConcurrentParallelNode&) = delete;
+  ConcurrentParallelNode(ConcurrentParallelNode&&) = delete;
+  ConcurrentParallelNode& operator=(ConcurrentParallelNode&&) = delete;
+
+private:
+  struct Round;
+  std::shared_ptr<Round> round_;
+  ThreadPool* pool_ = nullptr;
+
+  virtual BT::NodeStatus tick() override;
+};
+
+}  // namespace BT
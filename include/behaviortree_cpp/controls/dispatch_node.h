@@ -0,0 +1,77 @@
+#pragma once
+
+#include "behaviortree_cpp/control_node.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace BT
+{
+/**
+ * @brief The DispatchNode executes a branch (child) according to the value of
+ * a blackboard entry, like the SwitchNode, but with any number of cases.
+ *
+ * Example usage:
+ *
+
+<Dispatch variable="{mode}" cases="IDLE;EXPLORE;DOCK;CHARGE">
+   <ActionIdle/>
+   <ActionExplore/>
+   <ActionDock/>
+   <ActionCharge/>
+   <ActionDefault/>
+ </Dispatch>
+
+ * The cases are separated by ';' and there must be a child for each case,
+ * plus the default one (last).
+ *
+ * The cases are parsed only once, at the first tick, into a hash table; the
+ * branch is then selected in constant time, whatever the number of cases.
+ * For this reason the port "cases" must be a literal and can not contain
+ * duplicates.
+ *
+ * The variable matches a case if it is the same string or, when both of
+ * them are integers (or names of enums), the same number.
+ * Differently from the SwitchNode, real numbers are compared as strings.
+ *
+ * If the selected branch changes while the previous one is RUNNING,
+ * the latter is halted.
+ */
+class DispatchNode : public ControlNode
+{
+public:
+  DispatchNode(const std::string& name, const NodeConfig& config);
+
+  ~DispatchNode() override = default;
+
+  DispatchNode(const DispatchNode&) = delete;
+  DispatchNode& operator=(const DispatchNode&) = delete;
+  DispatchNode(DispatchNode&&) = delete;
+  DispatchNode& operator=(DispatchNode&&) = delete;
+
+  static PortsList providedPorts()
+  {
+    return { InputPort<std::string>("variable"),
+             InputPort<std::string>(CASES, "list of the cases, separated by ';'") };
+  }
+
+  void halt() override;
+
+private:
+  int running_child_ = -1;
+  bool cases_parsed_ = false;
+  std::unordered_map<std::string, size_t> string_cases_;
+  std::unordered_map<int64_t, size_t> integer_cases_;
+  static constexpr const char* CASES = "cases";
+
+  void parseCases();
+
+  // index of the child selected by the value of the variable
+  size_t findCase(const std::string& variable) const;
+
+  bool toInteger(const std::string& str, int64_t& value) const;
+
+  virtual BT::NodeStatus tick() override;
+};
+
+}  // namespace BT
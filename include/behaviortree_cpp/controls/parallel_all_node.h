@@ -14,7 +14,7 @@
 
 #include "behaviortree_cpp/control_node.h"
 
-#include <set>
+#include <vector>
 
 namespace BT
 {
@@ -59,9 +59,13 @@ public:
 private:
   size_t failure_threshold_;
 
-  std::set<size_t> completed_list_;
+  // indexed by child; allocated once, instead of at every tick
+  std::vector<bool> completed_list_;
+  size_t completed_count_ = 0;
   size_t failure_count_ = 0;
 
+  void clear();
+
   virtual BT::NodeStatus tick() override;
 };
 
@@ -15,7 +15,7 @@
 
 #include "behaviortree_cpp/control_node.h"
 
-#include <set>
+#include <vector>
 
 namespace BT
 {
@@ -69,11 +69,30 @@ public:
   void setSuccessThreshold(int threshold);
   void setFailureThreshold(int threshold);
 
+protected:
+  /// Read the thresholds from the ports (if needed) and validate them.
+  void readThresholds();
+
+  /// True if the child at the given index returned SUCCESS or FAILURE.
+  bool isCompleted(size_t index) const
+  {
+    return index < completed_list_.size() && completed_list_[index];
+  }
+
+  /// Update the counters with the status returned by the child at the given index.
+  void updateCounters(size_t index, NodeStatus child_status, size_t& skipped_count);
+
+  /// SUCCESS or FAILURE if one of the thresholds was reached, IDLE otherwise.
+  NodeStatus checkThresholds(size_t skipped_count) const;
+
+  void clear();
+
 private:
   int success_threshold_;
   int failure_threshold_;
 
-  std::set<size_t> completed_list_;
+  // indexed by child; allocated once, instead of at every tick
+  std::vector<bool> completed_list_;
 
   size_t success_count_ = 0;
   size_t failure_count_ = 0;
@@ -83,8 +102,6 @@ private:
   static constexpr const char* THRESHOLD_FAILURE = "failure_count";
 
   virtual BT::NodeStatus tick() override;
-
-  void clear();
 };
 
 }  // namespace BT
@@ -13,6 +13,7 @@
 #pragma once
 
 #include "behaviortree_cpp/control_node.h"
+#include "behaviortree_cpp/utils/condition_cache.h"
 
 namespace BT
 {
@@ -29,6 +30,14 @@ namespace BT
  * IMPORTANT: to work properly, this node should not have more than a single
  *            asynchronous child.
  *
+ * If the port "incremental" is true, a ConditionNode child is ticked again
+ * only if one of the blackboard entries remapped to its input ports was
+ * updated; otherwise its previous result is reused (see ConditionCache).
+ * This produces the same result of a full re-evaluation, as long as the
+ * conditions depend exclusively on their input ports.
+ * Note that loggers don't receive the status changes of the children that
+ * are not ticked.
+ *
  */
 class ReactiveSequence : public ControlNode
 {
@@ -36,6 +45,20 @@ public:
   ReactiveSequence(const std::string& name) : ControlNode(name, {})
   {}
 
+  ReactiveSequence(const std::string& name, const NodeConfig& config)
+    : ControlNode(name, config), read_parameter_from_ports_(true)
+  {}
+
+  static PortsList providedPorts()
+  {
+    return { InputPort<bool>(INCREMENTAL, false,
+                             "if true, the conditions are ticked again only when "
+                             "their inputs are updated") };
+  }
+
+  /// Used when the node was not created with the ports.
+  void setIncremental(bool enable);
+
   /** A ReactiveSequence is not supposed to have more than a single
   * anychronous node; if it does an exception is thrown.
   * You can disabled that check, if you know what you are doing.
@@ -48,6 +71,10 @@ private:
   void halt() override;
 
   int running_child_ = -1;
+  bool incremental_ = false;
+  bool read_parameter_from_ports_ = false;
+  ConditionCache condition_cache_;
+  static constexpr const char* INCREMENTAL = "incremental";
 
   static bool throw_if_multiple_running;
 };
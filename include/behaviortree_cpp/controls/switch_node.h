@@ -36,6 +36,9 @@ namespace BT
 When the SwitchNode is executed (Switch3 is a node with 3 cases)
 the "variable" will be compared to the cases and execute the correct child
 or the default one (last).
+
+The cases with a literal value are parsed only once, at the first tick;
+only the ones remapped to the blackboard are read again at each tick.
  *
  */
 
@@ -44,7 +47,21 @@ namespace details
 
 bool CheckStringEquality(const std::string& v1, const std::string& v2,
                          const ScriptingEnumsRegistry* enums);
-}
+
+/// Value of the variable or of a case of the SwitchNode, parsed once.
+struct SwitchCase
+{
+  std::string str;
+  // true if str is a number or the name of an enum
+  bool is_number = false;
+  double number = 0;
+};
+
+SwitchCase ParseSwitchCase(std::string str, const ScriptingEnumsRegistry* enums);
+
+/// Same result of CheckStringEquality(), applied to parsed values.
+bool CheckCaseEquality(const SwitchCase& v1, const SwitchCase& v2);
+}  // namespace details
 
 template <size_t NUM_CASES>
 class SwitchNode : public ControlNode
@@ -64,8 +81,25 @@ public:
   static PortsList providedPorts();
 
 private:
+  struct Case
+  {
+    enum Source
+    {
+      MISSING,
+      LITERAL,
+      BLACKBOARD
+    };
+    Source source = MISSING;
+    details::SwitchCase value;
+  };
+
   int running_child_ = -1;
   std::vector<std::string> case_keys_;
+  std::vector<Case> cases_;
+  bool cases_parsed_ = false;
+
+  void parseCases();
+
   virtual BT::NodeStatus tick() override;
 };
 
@@ -108,6 +142,33 @@ inline PortsList SwitchNode<NUM_CASES>::providedPorts()
   return provided_ports;
 }
 
+template <size_t NUM_CASES>
+inline void SwitchNode<NUM_CASES>::parseCases()
+{
+  const auto* enums = this->config().enums.get();
+  const auto& input_ports = this->config().input_ports;
+  cases_.resize(NUM_CASES);
+  for(size_t index = 0; index < NUM_CASES; ++index)
+  {
+    Case& case_value = cases_[index];
+    const auto it = input_ports.find(case_keys_[index]);
+    if(it == input_ports.end())
+    {
+      case_value.source = Case::MISSING;
+    }
+    else if(getRemappedKey(it->first, it->second))
+    {
+      case_value.source = Case::BLACKBOARD;
+    }
+    else
+    {
+      case_value.source = Case::LITERAL;
+      case_value.value = details::ParseSwitchCase(it->second, enums);
+    }
+  }
+  cases_parsed_ = true;
+}
+
 template <size_t NUM_CASES>
 inline NodeStatus SwitchNode<NUM_CASES>::tick()
 {
@@ -117,6 +178,12 @@ inline NodeStatus SwitchNode<NUM_CASES>::tick()
                      "must be (num_cases + default)");
   }
 
+  if(!cases_parsed_)
+  {
+    parseCases();
+  }
+
+  const auto* enums = this->config().enums.get();
   std::string variable;
   std::string value;
   int match_index = int(NUM_CASES);  // default index;
@@ -124,17 +191,25 @@ inline NodeStatus SwitchNode<NUM_CASES>::tick()
   // no variable? jump to default
   if(getInput("variable", variable))
   {
+    const auto parsed_variable = details::ParseSwitchCase(std::move(variable), enums);
     // check each case until you find a match
     for(int index = 0; index < int(NUM_CASES); ++index)
     {
-      const std::string& case_key = case_keys_[index];
-      if(getInput(case_key, value))
+      const Case& case_value = cases_[index];
+      bool match = false;
+      if(case_value.source == Case::LITERAL)
+      {
+        match = details::CheckCaseEquality(parsed_variable, case_value.value);
+      }
+      else if(case_value.source == Case::BLACKBOARD && getInput(case_keys_[index], value))
+      {
+        match = details::CheckCaseEquality(parsed_variable,
+                                           details::ParseSwitchCase(value, enums));
+      }
+      if(match)
       {
-        if(details::CheckStringEquality(variable, value, this->config().enums.get()))
-        {
-          match_index = index;
-          break;
-        }
+        match_index = index;
+        break;
       }
     }
   }
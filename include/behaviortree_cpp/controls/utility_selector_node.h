@@ -0,0 +1,127 @@
+#pragma once
+
+#include "behaviortree_cpp/control_node.h"
+#include "behaviortree_cpp/scripting/script_parser.hpp"
+#include "behaviortree_cpp/utils/condition_cache.h"
+
+#include <string>
+#include <vector>
+
+namespace BT
+{
+/**
+ * @brief The UtilitySelector ticks the child with the highest score.
+ * It is similar to a ReactiveFallback, where the order of the children
+ * is given by their scores, instead of their position.
+ *
+ * Example usage:
+ *
+
+<UtilitySelector scores="10 - distance; battery * 0.5; 5" hysteresis="1.0">
+   <Patrol/>
+   <GoCharging/>
+   <Idle/>
+</UtilitySelector>
+
+ * The port "scores" contains a script expression for each child,
+ * separated by ';'. The expressions are compiled once and can not
+ * modify the blackboard: a score is evaluated again only when one
+ * of the blackboard entries it reads is updated.
+ *
+ * Alternatively, "scores" can be a blackboard entry with one score per child,
+ * as std::vector<double> (or a string like "1;2;3"), computed for instance by
+ * another node:
+
+<UtilitySelector scores="{utilities}">
+
+ * It is read again only when the entry is updated.
+ *
+ * Note that an update is detected through the sequence_id of the entry:
+ * values modified in place with Blackboard::getAnyLocked() don't change it,
+ * and the cached scores are not computed again.
+ *
+ * At each tick, the child with the highest score is ticked (the first one,
+ * if two scores are equal):
+ *
+ * - If it returns RUNNING, this node returns RUNNING.
+ * - If it returns SUCCESS, this node returns SUCCESS.
+ * - If it returns FAILURE, the child with the next highest score is ticked.
+ *
+ * If all the children fail, this node returns FAILURE.
+ *
+ * While a child is RUNNING, it is halted in favor of another one only if
+ * the score of the latter is higher by more than "hysteresis".
+ */
+class UtilitySelectorNode : public ControlNode
+{
+public:
+  UtilitySelectorNode(const std::string& name, const NodeConfig& config);
+
+  ~UtilitySelectorNode() override = default;
+
+  UtilitySelectorNode(const UtilitySelectorNode&) = delete;
+  UtilitySelectorNode& operator=(const UtilitySelectorNode&) = delete;
+  UtilitySelectorNode(UtilitySelectorNode&&) = delete;
+  UtilitySelectorNode& operator=(UtilitySelectorNode&&) = delete;
+
+  static PortsList providedPorts()
+  {
+    return { InputPort(SCORES, "script expressions computing the score of each "
+                               "child, separated by ';', or a blackboard entry "
+                               "with a vector of scores"),
+             InputPort<double>(HYSTERESIS, 0.0,
+                               "margin required to halt the RUNNING child in favor "
+                               "of another one") };
+  }
+
+  void halt() override;
+
+  /// Scores of the children, computed during the last tick.
+  std::vector<double> scores() const;
+
+private:
+  struct Score
+  {
+    ScriptFunction function;
+    // identifiers used by the expression: entries of the blackboard or enums
+    std::vector<std::string> names;
+    double value = 0;
+    // false if it must be evaluated again
+    bool valid = false;
+  };
+
+  // blackboard entry read by one or more scores
+  struct Input
+  {
+    WatchedEntry watched;
+    std::vector<size_t> scores;
+  };
+
+  std::vector<Score> scores_;
+  std::vector<Input> inputs_;
+  // used instead of the scripts, if "scores" is a blackboard entry
+  WatchedEntry scores_entry_;
+  bool inputs_found_ = false;
+
+  int running_child_ = -1;
+  double hysteresis_ = 0;
+  // children sorted by score, reused at each tick
+  std::vector<size_t> order_;
+
+  static constexpr const char* SCORES = "scores";
+  static constexpr const char* HYSTERESIS = "hysteresis";
+
+  void parseScores();
+
+  void findInputs();
+
+  void updateScores();
+
+  void readScoresEntry();
+
+  size_t bestChild() const;
+
+  virtual BT::NodeStatus tick() override;
+};
+
+}  // namespace BT
@@ -13,8 +13,11 @@
 #pragma once
 
 #include "behaviortree_cpp/decorator_node.h"
+#include "behaviortree_cpp/utils/mpsc_queue.hpp"
 
+#include <algorithm>
 #include <deque>
+#include <optional>
 #include <vector>
 
 namespace BT
@@ -25,6 +28,10 @@ namespace BT
 template <typename T>
 using SharedQueue = std::shared_ptr<std::deque<T>>;
 
+// elements popped at once by the LoopNode, shared with its child without copies
+template <typename T>
+using SharedBatch = std::shared_ptr<std::vector<T>>;
+
 /**
  * @brief The LoopNode class is used to pop_front elements from a std::deque.
  * This element is copied into the port "value" and the child will be executed,
@@ -32,6 +39,13 @@ using SharedQueue = std::shared_ptr<std::deque<T>>;
  *
  * See Example 4: ex04_waypoints
  *
+ * The queue can also be a SharedMPSCQueue<T>, that other threads can push
+ * into without locking the blackboard entry.
+ *
+ * If "batch_size" is greater than 0, up to batch_size elements are popped at
+ * once and moved into the port "batch" (a SharedBatch<T>), instead of "value":
+ * the child is executed once per batch, that can be shared without copies.
+ *
  * NOTE: unless T is `Any`, `string` or `double`, you must register the loop manually into
  * the factory.
  */
@@ -39,8 +53,49 @@ template <typename T = Any>
 class LoopNode : public DecoratorNode
 {
   bool child_running_ = false;
+  unsigned batch_size_ = 0;
   SharedQueue<T> static_queue_;
   SharedQueue<T> current_queue_;
+  SharedMPSCQueue<T> mpsc_queue_;
+
+  std::optional<T> popFront()
+  {
+    if(current_queue_ && !current_queue_->empty())
+    {
+      auto value = std::move(current_queue_->front());
+      current_queue_->pop_front();
+      return value;
+    }
+    if(mpsc_queue_)
+    {
+      return mpsc_queue_->tryPop();
+    }
+    return std::nullopt;
+  }
+
+  bool popBatch()
+  {
+    auto batch = std::make_shared<std::vector<T>>();
+    if(current_queue_)
+    {
+      batch->reserve(std::min<size_t>(batch_size_, current_queue_->size()));
+    }
+    while(batch->size() < batch_size_)
+    {
+      auto value = popFront();
+      if(!value)
+      {
+        break;
+      }
+      batch->push_back(std::move(*value));
+    }
+    if(batch->empty())
+    {
+      return false;
+    }
+    setOutput<SharedBatch<T>>("batch", std::move(batch));
+    return true;
+  }
 
 public:
   LoopNode(const std::string& name, const NodeConfig& config)
@@ -60,6 +115,11 @@ public:
     {
       child_running_ = false;
       current_queue_.reset();
+      mpsc_queue_.reset();
+      if(!getInput("batch_size", batch_size_))
+      {
+        throw RuntimeError("LoopNode: invalid value of the port 'batch_size'");
+      }
 
       // special case: the port contains a string that was converted to SharedQueue<T>
       if(static_queue_)
@@ -73,9 +133,10 @@ public:
     if(!child_running_)
     {
       // if the port is static, any_ref is empty, otherwise it will keep access to
-      // port locked for thread-safety
-      AnyPtrLocked any_ref =
-          static_queue_ ? AnyPtrLocked() : getLockedPortContent("queue");
+      // port locked for thread-safety. A SharedMPSCQueue doesn't need it.
+      AnyPtrLocked any_ref = (static_queue_ || mpsc_queue_) ?
+                                 AnyPtrLocked() :
+                                 getLockedPortContent("queue");
       if(any_ref)
       {
         // Try SharedQueue<T> first, then fall back to std::vector<T>.
@@ -90,8 +151,12 @@ public:
         {
           // Only convert on first read; after that, use the
           // already-converted current_queue_ (which gets popped).
-          auto vec_result = any_ref.get()->tryCast<std::vector<T>>();
-          if(vec_result)
+          if(auto mpsc_result = any_ref.get()->tryCast<SharedMPSCQueue<T>>())
+          {
+            // read once: the following iterations don't lock the port
+            mpsc_queue_ = mpsc_result.value();
+          }
+          else if(auto vec_result = any_ref.get()->tryCast<std::vector<T>>())
           {
             // Accept std::vector<T> from upstream nodes. Issue #969.
             const auto& vec = vec_result.value();
@@ -106,17 +171,20 @@ public:
           else
           {
             throw RuntimeError("LoopNode: port 'queue' must contain either "
-                               "SharedQueue<T>, std::vector<T>, or a string");
+                               "SharedQueue<T>, SharedMPSCQueue<T>, std::vector<T>, "
+                               "or a string");
           }
         }
       }
 
-      if(current_queue_ && !current_queue_->empty())
+      if(batch_size_ > 0)
+      {
+        popped = popBatch();
+      }
+      else if(auto value = popFront())
       {
-        auto value = std::move(current_queue_->front());
-        current_queue_->pop_front();
         popped = true;
-        setOutput("value", value);
+        setOutput("value", std::move(*value));
       }
     }
 
@@ -153,7 +221,12 @@ public:
              InputPort<NodeStatus>("if_empty", NodeStatus::SUCCESS,
                                    "Status to return if queue is empty: "
                                    "SUCCESS, FAILURE, SKIPPED"),
-             OutputPort<T>("value") };
+             OutputPort<T>("value"),
+             InputPort<unsigned>("batch_size", 0u,
+                                 "If greater than 0, pop up to batch_size elements "
+                                 "at once into the port 'batch'"),
+             OutputPort<SharedBatch<T>>("batch", "Elements popped at once, if "
+                                                 "batch_size is greater than 0") };
   }
 };
 
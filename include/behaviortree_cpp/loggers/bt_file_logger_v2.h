@@ -14,11 +14,16 @@ namespace BT
  *
  * Format:
  *
- * - first 4 bytes: size of the XML string (N)
+ * - the string "BTCPP4-FileLogger2", followed by the protocol version (1 byte)
+ * - next 4 bytes: size of the XML string (N)
  * - next N bytes: string containing the XML representing the tree.
  * - next 8 bytes: first timestamp (microseconds since epoch)
  * - next: each 9 bytes is a FileLogger2::Transition. See definition.
  *
+ * The protocol version is 1, unless the tree has UIDs larger than 65535:
+ * in that case it is 2 and the node_uid of each transition takes 4 bytes
+ * instead of 2 (11 bytes per transition).
+ *
  */
 class FileLogger2 : public StatusChangeLogger
 {
@@ -48,8 +53,8 @@ public:
     // when serializing, we will remove the initial time and serialize only
     // 6 bytes, instead of 8
     uint64_t timestamp_usec;
-    // if you have more than 64.000 nodes, you are doing something wrong :)
-    uint16_t node_uid;
+    // serialized with 2 bytes, unless the protocol is 2
+    uint32_t node_uid;
     // enough bits to contain NodeStatus
     uint8_t status;
   };
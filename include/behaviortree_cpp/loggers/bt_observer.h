@@ -2,6 +2,7 @@
 #define BT_OBSERVER_H
 
 #include "behaviortree_cpp/loggers/abstract_logger.h"
+#include "behaviortree_cpp/utils/duration_histogram.hpp"
 
 #include <cstring>
 
@@ -14,6 +15,13 @@ namespace BT
  *
  * It is particularly useful to create unit tests, since if allow to
  * determine if a certain transition happened as expected, in a non intrusive way.
+ *
+ * Additionally, it records the distribution of the duration of TreeNode::tick()
+ * for each node, using TreeNode::subscribeToTickMonitor() (the callbacks set
+ * with TreeNode::setTickMonitorCallback() and other observers are not affected).
+ *
+ * Statistics are stored in atomic counters, indexed by UID: they can be read
+ * or reset from any thread, while the tree is being ticked.
  */
 class TreeObserver : public StatusChangeLogger
 {
@@ -29,6 +37,8 @@ public:
   virtual void flush() override
   {}
 
+  /// Set all the counters and the tick durations to zero.
+  /// Can be called while the tree is being ticked.
   void resetStatistics();
 
   struct NodeStatistics
@@ -50,24 +60,38 @@ public:
     Duration last_timestamp = {};
   };
 
+  // number of tick() measured, and their percentiles
+  using TickDurationStatistics = details::DurationHistogram::Statistics;
+
   // find the statistics of a node, based on its path
-  const NodeStatistics& getStatistics(const std::string& path) const;
+  NodeStatistics getStatistics(const std::string& path) const;
 
   // find the statistics of a node, based on its TreeNode::UID()
-  const NodeStatistics& getStatistics(uint16_t uid) const;
+  NodeStatistics getStatistics(uint32_t uid) const;
+
+  // snapshot of all statistics
+  std::unordered_map<uint32_t, NodeStatistics> statistics() const;
 
-  // all statistics
-  const std::unordered_map<uint16_t, NodeStatistics>& statistics() const;
+  // find the tick durations of a node, based on its path
+  TickDurationStatistics getTickDurations(const std::string& path) const;
+
+  // find the tick durations of a node, based on its TreeNode::UID()
+  TickDurationStatistics getTickDurations(uint32_t uid) const;
+
+  // snapshot of all the tick durations
+  std::unordered_map<uint32_t, TickDurationStatistics> tickDurations() const;
 
   // path to UID map
-  const std::unordered_map<std::string, uint16_t>& pathToUID() const;
+  const std::unordered_map<std::string, uint32_t>& pathToUID() const;
 
-  const std::map<uint16_t, std::string>& uidToPath() const;
+  const std::map<uint32_t, std::string>& uidToPath() const;
 
 private:
-  std::unordered_map<uint16_t, NodeStatistics> _statistics;
-  std::unordered_map<std::string, uint16_t> _path_to_uid;
-  std::map<uint16_t, std::string> _uid_to_path;
+  std::unordered_map<std::string, uint32_t> _path_to_uid;
+  std::map<uint32_t, std::string> _uid_to_path;
+
+  struct PImpl;
+  std::unique_ptr<PImpl> _p;
 
   virtual void callback(Duration timestamp, const TreeNode& node, NodeStatus prev_status,
                         NodeStatus status) override;
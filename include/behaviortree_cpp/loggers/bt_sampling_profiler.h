@@ -0,0 +1,86 @@
+#pragma once
+
+#include "behaviortree_cpp/bt_factory.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace BT
+{
+
+/**
+ * @brief The SamplingProfiler periodically records which nodes of a Tree
+ * are RUNNING, from a separate thread.
+ *
+ * Differently from the StatusChangeLogger, it does not instrument the
+ * transitions of the nodes: its overhead depends on the sampling period,
+ * not on the frequency of the ticks.
+ *
+ * At each sample, the deepest RUNNING nodes are counted, together with the path
+ * of their ancestors. The profile can be exported as:
+ *
+ * - "folded stacks", the text format used by flamegraph.pl and speedscope:
+ *   one line per stack, with the frames separated by ';' and the number of samples.
+ * - Chrome trace JSON (chrome://tracing, Perfetto), where each node is an event
+ *   lasting as long as it was observed RUNNING.
+ *
+ * Synchronous nodes that return before a sample is taken are, by design, not
+ * visible: their time is attributed to the RUNNING parent.
+ *
+ * The memory used by the folded stacks depends only on the size of the tree,
+ * while the trace keeps the most recent events, up to a maximum number.
+ *
+ * The tree must outlive the profiler.
+ */
+class SamplingProfiler
+{
+public:
+  /**
+   * @param tree            the tree to profile
+   * @param sampling_period time between samples. If zero, no thread is started
+   *                        and samples are taken only by calling sample().
+   * @param max_trace_events maximum number of events of chromeTrace(). When it is
+   *                        reached, the oldest events are discarded.
+   */
+  SamplingProfiler(const Tree& tree,
+                   std::chrono::microseconds sampling_period = std::chrono::milliseconds(1),
+                   size_t max_trace_events = 100000);
+
+  ~SamplingProfiler();
+
+  SamplingProfiler(const SamplingProfiler&) = delete;
+  SamplingProfiler& operator=(const SamplingProfiler&) = delete;
+  SamplingProfiler(SamplingProfiler&&) = delete;
+  SamplingProfiler& operator=(SamplingProfiler&&) = delete;
+
+  /// Record the nodes that are RUNNING now. Thread-safe.
+  void sample();
+
+  /// Stop the sampling thread. Data collected so far is preserved.
+  void stop();
+
+  /// Discard the data collected so far.
+  void reset();
+
+  /// Number of samples taken since construction or reset().
+  [[nodiscard]] uint64_t samplesCount() const;
+
+  /// Number of trace events discarded since construction or reset(),
+  /// because more than max_trace_events were recorded.
+  [[nodiscard]] uint64_t droppedTraceEvents() const;
+
+  /// Profile in the "folded stacks" format, sorted by stack.
+  [[nodiscard]] std::string foldedStacks() const;
+
+  /// Profile in the Chrome trace event format (JSON).
+  [[nodiscard]] std::string chromeTrace() const;
+
+private:
+  struct PImpl;
+  std::unique_ptr<PImpl> _p;
+
+  void samplingLoop(std::chrono::microseconds sampling_period);
+};
+
+}  // namespace BT
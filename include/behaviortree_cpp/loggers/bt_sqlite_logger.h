@@ -3,6 +3,7 @@
 #include "behaviortree_cpp/loggers/abstract_logger.h"
 
 #include <filesystem>
+#include <vector>
 
 // forward declaration
 struct sqlite3;
@@ -80,14 +81,16 @@ public:
 private:
   sqlite3* db_ = nullptr;
 
+  // monotonic_timestamp_ and starting_time_ are protected by queue_mutex_
   int64_t monotonic_timestamp_ = 0;
-  std::unordered_map<const BT::TreeNode*, int64_t> starting_time_;
+  // when each node started RUNNING, indexed by UID (-1 if not running)
+  std::vector<int64_t> starting_time_;
 
   int session_id_ = -1;
 
   struct Transition
   {
-    uint16_t node_uid;
+    uint32_t node_uid;
     int64_t timestamp;
     int64_t duration;
     NodeStatus status;
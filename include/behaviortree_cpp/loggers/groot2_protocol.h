@@ -32,8 +32,12 @@ enum RequestType : uint8_t
   FULLTREE = 'T',
   // Request the status of all the nodes
   STATUS = 'S',
+  // Request only the status of the nodes changed since a given sequence number
+  STATUS_DELTA = 's',
   // retrieve the values in a set of blackboards
   BLACKBOARD = 'B',
+  // retrieve only the values changed since a given sequence number
+  BLACKBOARD_DELTA = 'b',
 
   // Groot requests the insertion of a hook
   HOOK_INSERT = 'I',
@@ -67,8 +71,12 @@ inline const char* ToString(const RequestType& type)
       return "full_tree";
     case RequestType::STATUS:
       return "status";
+    case RequestType::STATUS_DELTA:
+      return "status_delta";
     case RequestType::BLACKBOARD:
       return "blackboard";
+    case RequestType::BLACKBOARD_DELTA:
+      return "blackboard_delta";
 
     case RequestType::HOOK_INSERT:
       return "hook_insert";
@@ -95,7 +103,27 @@ inline const char* ToString(const RequestType& type)
   return "undefined";
 }
 
+/*
+ * The node_uid in the replies to STATUS, STATUS_DELTA and GET_TRANSITIONS
+ * is serialized as uint16_t with kProtocolID. Trees with UIDs larger than
+ * 65535 use kProtocolIDWideUID instead, where it is serialized as uint32_t.
+ * The protocol of the reply header tells the client which one is used.
+ */
 constexpr uint8_t kProtocolID = 2;
+constexpr uint8_t kProtocolIDWideUID = 3;
+
+/// The protocol to be used by a tree, given its largest TreeNode::UID()
+inline uint8_t ProtocolForMaxUID(uint32_t max_uid)
+{
+  return (max_uid > 0xFFFF) ? kProtocolIDWideUID : kProtocolID;
+}
+
+/// Number of bytes used to serialize a node_uid with the given protocol
+inline unsigned SerializedUIDSize(uint8_t protocol)
+{
+  return (protocol == kProtocolIDWideUID) ? sizeof(uint32_t) : sizeof(uint16_t);
+}
+
 using TreeUniqueUUID = std::array<char, 16>;
 
 struct RequestHeader
@@ -198,6 +226,89 @@ inline ReplyHeader DeserializeReplyHeader(const std::string& buffer)
   return header;
 }
 
+/*
+ * STATUS_DELTA request and reply.
+ *
+ * The second part of the request contains the sequence number (uint64_t)
+ * of the last status reply received by the client, or 0 to request a full snapshot.
+ *
+ * The second part of the reply contains:
+ *
+ *  - the current sequence number (uint64_t), to be acknowledged in the next request
+ *  - a flag (uint8_t) equal to 1 if the reply is a full snapshot
+ *  - a list of (node_uid: uint16_t, status: uint8_t), the same format used by STATUS
+ *    (node_uid is uint32_t with kProtocolIDWideUID)
+ *
+ * A full snapshot is sent when the acknowledged sequence is 0 or unknown to the
+ * publisher (for instance, because the executor was restarted): the sequences
+ * of each publisher start from a different epoch, so they are never confused
+ * with the ones of a previous publisher.
+ */
+struct StatusDeltaHeader
+{
+  uint64_t sequence = 0;
+  bool full_snapshot = false;
+
+  static size_t size()
+  {
+    return sizeof(uint64_t) + sizeof(uint8_t);
+  }
+};
+
+inline std::string SerializeStatusDeltaRequest(uint64_t acknowledged_sequence)
+{
+  std::string buffer;
+  buffer.resize(sizeof(uint64_t));
+  Serialize(buffer.data(), 0, acknowledged_sequence);
+  return buffer;
+}
+
+inline StatusDeltaHeader DeserializeStatusDeltaHeader(const std::string& buffer)
+{
+  StatusDeltaHeader header;
+  unsigned offset = 0;
+  offset += Deserialize(buffer.data(), offset, header.sequence);
+  uint8_t full = 0;
+  Deserialize(buffer.data(), offset, full);
+  header.full_snapshot = (full != 0);
+  return header;
+}
+
+/*
+ * BLACKBOARD_DELTA request and reply.
+ *
+ * The second part of the request contains the sequence number (uint64_t)
+ * of the last reply received by the client, or 0 to request all the entries,
+ * followed by the list of blackboards, separated by ';', as in BLACKBOARD.
+ * The sequence number is valid only if the list of blackboards didn't change.
+ *
+ * The reply is a MessagePack map with the same format of BLACKBOARD,
+ * but containing only the entries changed (or created) since that sequence
+ * number, plus two additional fields:
+ *
+ *  - [kSequenceKey]: the sequence number to be acknowledged in the next request;
+ *  - [kCompleteBlackboardsKey]: the array of the blackboards whose entries
+ *    were all included. The client must replace its copy of them, dropping
+ *    the entries that are missing in the reply. This happens when the
+ *    acknowledged sequence is 0 or unknown to the publisher, or when entries
+ *    were created or removed since then.
+ *
+ * As in STATUS_DELTA, the reply depends only on the acknowledged sequence:
+ * any number of clients can request deltas independently.
+ */
+constexpr const char* kSequenceKey = "__sequence__";
+constexpr const char* kCompleteBlackboardsKey = "__complete__";
+
+inline std::string SerializeBlackboardDeltaRequest(const std::string& bb_list,
+                                                   uint64_t acknowledged_sequence)
+{
+  std::string buffer;
+  buffer.resize(sizeof(uint64_t));
+  Serialize(buffer.data(), 0, acknowledged_sequence);
+  buffer.append(bb_list);
+  return buffer;
+}
+
 struct Hook
 {
   using Ptr = std::shared_ptr<Hook>;
@@ -213,7 +324,7 @@ struct Hook
 
   Position position = Position::PRE;
 
-  uint16_t node_uid = 0;
+  uint32_t node_uid = 0;
 
   enum class Mode
   {
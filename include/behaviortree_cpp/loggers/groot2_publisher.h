@@ -55,17 +55,29 @@ private:
 
   void updateStatusBuffer();
 
-  Expected<std::vector<uint8_t>> generateBlackboardsDump(const std::string& bb_list);
+  std::string generateStatusDelta(uint64_t acknowledged_sequence);
+
+  enum class DumpMode
+  {
+    // all the entries (BLACKBOARD)
+    FULL,
+    // only the entries changed since the acknowledged sequence (BLACKBOARD_DELTA)
+    DELTA
+  };
+
+  // The returned view refers to a buffer reused by the following calls
+  Expected<StringView> generateBlackboardsDump(const std::string& bb_list, DumpMode mode,
+                                               uint64_t acknowledged_sequence = 0);
 
   bool insertHook(Monitor::Hook::Ptr breakpoint);
 
-  bool unlockBreakpoint(Position pos, uint16_t node_uid, NodeStatus result, bool remove);
+  bool unlockBreakpoint(Position pos, uint32_t node_uid, NodeStatus result, bool remove);
 
-  bool removeHook(Position pos, uint16_t node_uid);
+  bool removeHook(Position pos, uint32_t node_uid);
 
   void removeAllHooks();
 
-  Monitor::Hook::Ptr getHook(Position pos, uint16_t node_uid);
+  Monitor::Hook::Ptr getHook(Position pos, uint32_t node_uid);
 
   struct PImpl;
   std::unique_ptr<PImpl> _p;
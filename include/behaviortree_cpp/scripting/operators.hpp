@@ -18,6 +18,7 @@
 #include <cmath>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 // Naive implementation of an AST with simple evaluation function.
@@ -95,8 +96,8 @@ struct ExprName : ExprBase
         return Any(double(enum_ptr->second));
       }
     }
-    // search now in the variables table
-    auto any_ref = env.vars->getAnyLocked(name);
+    // search now in the variables table (read-only access)
+    auto any_ref = std::as_const(*env.vars).getAnyLocked(name);
     if(!any_ref)
     {
       throw RuntimeError(StrCat("Variable not found: ", name));
@@ -16,13 +16,16 @@
 #include "behaviortree_cpp/basic_types.h"
 #include "behaviortree_cpp/blackboard.h"
 #include "behaviortree_cpp/scripting/script_parser.hpp"
+#include "behaviortree_cpp/utils/clock.h"
 #include "behaviortree_cpp/utils/signal.h"
 #include "behaviortree_cpp/utils/strcat.hpp"
+#include "behaviortree_cpp/utils/tick_deadline.hpp"
 #include "behaviortree_cpp/utils/wakeup_signal.hpp"
 
 #include <charconv>
 #include <exception>
 #include <map>
+#include <optional>
 #include <utility>
 
 #ifdef _MSC_VER
@@ -121,8 +124,8 @@ struct NodeConfig
 
   const TreeNodeManifest* manifest = nullptr;
 
-  // Numeric unique identifier
-  uint16_t uid = 0;
+  // Numeric unique identifier. See Tree::nodeByUID()
+  uint32_t uid = 0;
   // Unique human-readable name, that encapsulate the subtree
   // hierarchy, for instance, given 2 nested trees, it should be:
   //
@@ -136,6 +139,77 @@ struct NodeConfig
 // back compatibility
 using NodeConfiguration = NodeConfig;
 
+class TreeNode;
+
+/**
+ * @brief InputPortHandle is a typed accessor to an input port, created with
+ * TreeNode::bindInput<T>(), usually in the constructor of the node.
+ *
+ * Reading it gives the same result as TreeNode::getInput<T>(), but the
+ * lookups by name are done only once:
+ *
+ * - literals and default values are converted when the handle is created.
+ * - the blackboard entry is resolved the first time it is found.
+ *
+ * Like tick(), it should not be used concurrently by multiple threads.
+ * It must not outlive the node that created it.
+ */
+template <typename T>
+class InputPortHandle
+{
+public:
+  InputPortHandle() = default;
+
+  /// Same as TreeNode::getInputStamped(key, destination)
+  [[nodiscard]] Expected<Timestamp> get(T& destination) const;
+
+  /// Same as TreeNode::getInput<T>(key)
+  [[nodiscard]] Expected<T> get() const
+  {
+    T out{};
+    if(auto res = get(out); !res)
+    {
+      return nonstd::make_unexpected(res.error());
+    }
+    return out;
+  }
+
+  /// Same as TreeNode::getInputStamped<T>(key)
+  [[nodiscard]] Expected<StampedValue<T>> getStamped() const
+  {
+    StampedValue<T> out;
+    if(auto res = get(out.value))
+    {
+      out.stamp = *res;
+      return out;
+    }
+    else
+    {
+      return nonstd::make_unexpected(res.error());
+    }
+  }
+
+  /// Name of the port
+  [[nodiscard]] const std::string& key() const
+  {
+    return key_;
+  }
+
+private:
+  friend class TreeNode;
+
+  const TreeNode* node_ = nullptr;
+  std::string key_;
+  // error detected when the handle was created
+  std::string error_;
+  // value of a literal or default value, already converted
+  std::optional<T> constant_;
+  // used when the value in the blackboard is a string. Owned by the manifest
+  const StringConverter* converter_ = nullptr;
+  std::string blackboard_key_;
+  mutable std::weak_ptr<Blackboard::Entry> entry_;
+};
+
 template <typename T>
 inline constexpr bool hasNodeNameCtor()
 {
@@ -201,6 +275,7 @@ public:
   using PostTickCallback = std::function<NodeStatus(TreeNode&, NodeStatus)>;
   using TickMonitorCallback =
       std::function<void(TreeNode&, NodeStatus, std::chrono::microseconds)>;
+  using TickMonitorSubscriber = std::shared_ptr<TickMonitorCallback>;
 
   /**
      * @brief subscribeToStatusChange is used to attach a callback to a status change.
@@ -245,9 +320,21 @@ public:
    */
   void setTickMonitorCallback(TickMonitorCallback callback);
 
+  /**
+   * @brief subscribeToTickMonitor attaches a callback with the same signature of
+   * setTickMonitorCallback(), without replacing it or the other subscribers.
+   * When TickMonitorSubscriber goes out of scope (it is a shared_ptr) the callback
+   * is unsubscribed automatically.
+   *
+   * Thread-safe: it can be invoked while the node is being ticked.
+   *
+   * @return the subscriber handle.
+   */
+  [[nodiscard]] TickMonitorSubscriber subscribeToTickMonitor(TickMonitorCallback callback);
+
   /// The unique identifier of this instance of treeNode.
   /// It is assigneld by the factory
-  [[nodiscard]] uint16_t UID() const;
+  [[nodiscard]] uint32_t UID() const;
 
   /// Human readable identifier, that includes the hierarchy of Subtrees
   /// See tutorial 10 as an example.
@@ -316,6 +403,35 @@ public:
     }
   }
 
+  /**
+   * @brief getInputShared is similar to getInput<T>(key), but it returns an
+   * immutable snapshot that readers share, instead of a copy.
+   *
+   * For large values (paths, point clouds, maps) this avoids copying the value
+   * at every tick: the blackboard entry is copied at most once after each
+   * write, literals and default values only once.
+   * The snapshot is not affected by later writes to the port.
+   *
+   * @param key   the name of the port.
+   */
+  template <typename T>
+  [[nodiscard]] Expected<std::shared_ptr<const T>>
+  getInputShared(const std::string& key) const;
+
+  /**
+   * @brief bindInput creates a typed handle to the input port, that can be read
+   * many times without looking up the port by name. See InputPortHandle.
+   *
+   *     // in the constructor
+   *     goal_port_ = bindInput<Pose2D>("goal");
+   *     // in tick()
+   *     auto goal = goal_port_.get();
+   *
+   * @param key   the name of the port.
+   */
+  template <typename T>
+  [[nodiscard]] InputPortHandle<T> bindInput(const std::string& key) const;
+
   /**
    * @brief setOutput modifies the content of an Output port
    * @param key    the name of the port.
@@ -325,6 +441,10 @@ public:
   template <typename T>
   Result setOutput(const std::string& key, const T& value);
 
+  /// Same as setOutput(key, value), but the value is moved into the blackboard.
+  template <typename T, typename = std::enable_if_t<is_movable_into_any<T>::value>>
+  Result setOutput(const std::string& key, T&& value);
+
   /**
    * @brief getLockedPortContent should be used when:
    *
@@ -375,6 +495,15 @@ public:
 
   [[nodiscard]] bool requiresWakeUp() const;
 
+  /// True if the tree is ticked with Tree::tickOnceUntil() and the deadline was
+  /// reached. Control nodes can check it between children, to return RUNNING
+  /// and resume from the next child at the following tick.
+  [[nodiscard]] bool tickDeadlineExpired() const;
+
+  /// Clock of the tree, see Tree::setClock(). Nodes using a TimerQueue
+  /// should pass it to TimerQueue::setClock().
+  [[nodiscard]] const std::shared_ptr<Clock>& clock() const;
+
   /** Used to inject config into a node, even if it doesn't have the proper
      *  constructor
      */
@@ -403,6 +532,8 @@ protected:
   friend class DecoratorNode;
   friend class ControlNode;
   friend class Tree;
+  template <typename U>
+  friend class InputPortHandle;
 
   [[nodiscard]] NodeConfig& config();
 
@@ -417,6 +548,10 @@ protected:
 
   void setWakeUpInstance(std::shared_ptr<WakeUpSignal> instance);
 
+  void setTickDeadlineInstance(std::shared_ptr<TickDeadline> instance);
+
+  void setClockInstance(std::shared_ptr<Clock> instance);
+
   void modifyPortsRemapping(const PortsRemapping& new_remapping);
 
   /**
@@ -442,6 +577,36 @@ private:
   Expected<NodeStatus> checkPreConditions();
   void checkPostConditions(NodeStatus status);
 
+  /// Key of the blackboard entry written by an output port.
+  [[nodiscard]] Expected<StringView> getOutputBlackboardKey(const std::string& key,
+                                                            bool is_any_type);
+
+  struct ResolvedInputPort
+  {
+    // the value in the XML or, if missing, the default value as a string.
+    // It is either a literal or a blackboard pointer
+    StringView value;
+    // not null if the default value is used and it is not a string
+    const Any* default_value = nullptr;
+    // the port in the manifest, if any
+    const PortInfo* info = nullptr;
+  };
+
+  /// Find the value of an input port: the XML first, then the default value of
+  /// the manifest. Used by getInputStamped(), getInputShared() and bindInput().
+  [[nodiscard]] Expected<ResolvedInputPort> resolveInputPort(const std::string& key) const;
+
+  /// Value of an input port, given as a literal and already converted to the
+  /// requested type. Return nullptr if it was never converted.
+  [[nodiscard]] std::shared_ptr<const linb::any>
+  findLiteralPort(const std::string& key, StringView literal,
+                  const std::type_info& type) const;
+
+  /// Store the converted value of a literal input port. Ignored if a value of
+  /// the same type, but a different literal, is already stored.
+  void cacheLiteralPort(const std::string& key, StringView literal,
+                        linb::any value) const;
+
   /// The method used to interrupt the execution of a RUNNING node.
   /// Only Async nodes that may return RUNNING should implement it.
   virtual void halt() = 0;
@@ -481,72 +646,52 @@ template <typename T>
 inline Expected<Timestamp> TreeNode::getInputStamped(const std::string& key,
                                                      T& destination) const
 {
-  std::string port_value_str;
-
-  auto input_port_it = config().input_ports.find(key);
-  if(input_port_it != config().input_ports.end())
+  auto port = resolveInputPort(key);
+  if(!port)
   {
-    port_value_str = input_port_it->second;
+    return nonstd::make_unexpected(port.error());
   }
-  else if(!config().manifest)
+  if(port->default_value != nullptr)
   {
-    return nonstd::make_unexpected(StrCat("getInput() of node '", fullPath(),
-                                          "' failed because the manifest is "
-                                          "nullptr (WTF?) and the key: [",
-                                          key, "] is missing"));
+    destination = port->default_value->cast<T>();
+    return Timestamp{};
   }
-  else
-  {
-    // maybe it is declared with a default value in the manifest
-    auto port_manifest_it = config().manifest->ports.find(key);
-    if(port_manifest_it == config().manifest->ports.end())
-    {
-      return nonstd::make_unexpected(StrCat("getInput() of node '", fullPath(),
-                                            "' failed because the manifest doesn't "
-                                            "contain the key: [",
-                                            key, "]"));
-    }
-    const auto& port_info = port_manifest_it->second;
-    // there is a default value
-    if(port_info.defaultValue().empty())
+
+  // The converter stored in the manifest, used to parse strings. This fixes
+  // the plugin issue where convertFromString<T> specializations are not
+  // visible across shared library boundaries (issue #953).
+  // Numbers, bool and vectors of them are parsed without exceptions instead.
+  auto portConverter = [&port]() -> const StringConverter* {
+    if constexpr(!HasNoThrowStringConversion<T>)
     {
-      return nonstd::make_unexpected(StrCat("getInput() of node '", fullPath(),
-                                            "' failed because nor the manifest or the "
-                                            "XML contain the key: [",
-                                            key, "]"));
+      if(port->info != nullptr && port->info->converter())
+      {
+        return &port->info->converter();
+      }
     }
-    if(port_info.defaultValue().isString())
+    return nullptr;
+  };
+
+  // Helper lambda to parse string using the stored converter if available,
+  // otherwise fall back to convertFromString<T>.
+  auto parseStringWithConverter = [this](StringView str,
+                                         const StringConverter* converter) -> Expected<T> {
+    if constexpr(HasNoThrowStringConversion<T>)
     {
-      port_value_str = port_info.defaultValue().cast<std::string>();
+      return tryConvertFromString<T>(str);
     }
     else
     {
-      destination = port_info.defaultValue().cast<T>();
-      return Timestamp{};
-    }
-  }
-
-  // Helper lambda to parse string using the stored converter if available,
-  // otherwise fall back to convertFromString<T>. This fixes the plugin issue
-  // where convertFromString<T> specializations are not visible across shared
-  // library boundaries (issue #953).
-  auto parseStringWithConverter = [this, &key](const std::string& str) -> T {
-    if(config().manifest)
-    {
-      auto port_it = config().manifest->ports.find(key);
-      if(port_it != config().manifest->ports.end())
+      if(converter != nullptr)
       {
-        const auto& converter = port_it->second.converter();
-        if(converter)
-        {
-          return converter(str).template cast<T>();
-        }
+        return (*converter)(str).template cast<T>();
       }
+      // Fall back to parseString which calls convertFromString
+      return parseString<T>(std::string(str));
     }
-    // Fall back to parseString which calls convertFromString
-    return parseString<T>(str);
   };
 
+  const StringView port_value_str = port->value;
   auto blackboard_ptr = getRemappedKey(key, port_value_str);
   try
   {
@@ -555,7 +700,33 @@ inline Expected<Timestamp> TreeNode::getInputStamped(const std::string& key,
     {
       try
       {
-        destination = parseStringWithConverter(port_value_str);
+        if constexpr(std::is_same_v<T, Any>)
+        {
+          auto value = parseStringWithConverter(port_value_str, portConverter());
+          if(!value)
+          {
+            return nonstd::make_unexpected(StrCat("getInput(): ", value.error()));
+          }
+          destination = std::move(value.value());
+        }
+        else
+        {
+          // the literal is converted only once, the first time it is read as T
+          if(auto cached = findLiteralPort(key, port_value_str, typeid(T)))
+          {
+            destination = *linb::any_cast<T>(cached.get());
+          }
+          else
+          {
+            auto value = parseStringWithConverter(port_value_str, portConverter());
+            if(!value)
+            {
+              return nonstd::make_unexpected(StrCat("getInput(): ", value.error()));
+            }
+            destination = std::move(value.value());
+            cacheLiteralPort(key, port_value_str, linb::any(destination));
+          }
+        }
       }
       catch(std::exception& ex)
       {
@@ -571,7 +742,7 @@ inline Expected<Timestamp> TreeNode::getInputStamped(const std::string& key,
                                      "an invalid Blackboard");
     }
 
-    if(auto entry = config().blackboard->getEntry(std::string(blackboard_key)))
+    if(auto entry = config().blackboard->getEntry(blackboard_key))
     {
       std::unique_lock lk(entry->entry_mutex);
       auto& any_value = entry->value;
@@ -587,7 +758,17 @@ inline Expected<Timestamp> TreeNode::getInputStamped(const std::string& key,
       {
         if(!std::is_same_v<T, std::string> && any_value.isString())
         {
-          destination = parseStringWithConverter(any_value.cast<std::string>());
+          // the values parsed with different converters are memoized separately
+          const StringConverter* converter = portConverter();
+          auto value =
+              Blackboard::getConverted<T>(*entry, converter, [&](StringView str) {
+                return parseStringWithConverter(str, converter);
+              });
+          if(!value)
+          {
+            return nonstd::make_unexpected(value.error());
+          }
+          destination = std::move(value.value());
         }
         else
         {
@@ -625,47 +806,231 @@ inline Result TreeNode::getInput(const std::string& key, T& destination) const
 }
 
 template <typename T>
-inline Result TreeNode::setOutput(const std::string& key, const T& value)
+inline Expected<std::shared_ptr<const T>>
+TreeNode::getInputShared(const std::string& key) const
 {
-  if(!config().blackboard)
+  using SharedT = std::shared_ptr<const T>;
+
+  auto port = resolveInputPort(key);
+  if(!port)
   {
-    return nonstd::make_unexpected("setOutput() failed: trying to access a "
-                                   "Blackboard(BB) entry, but BB is invalid");
+    return nonstd::make_unexpected(port.error());
   }
+  const StringView port_value_str = port->value;
+  const PortInfo* port_info = port->info;
 
-  auto remap_it = config().output_ports.find(key);
-  if(remap_it == config().output_ports.end())
+  auto blackboard_key = getRemappedKey(key, port_value_str);
+  if(port->default_value != nullptr || !blackboard_key)
   {
-    return nonstd::make_unexpected(StrCat("setOutput() failed: "
-                                          "NodeConfig::output_ports "
-                                          "does not contain the key: [",
-                                          key, "]"));
+    // literals and default values: share the same instance
+    if(auto cached = findLiteralPort(key, port_value_str, typeid(SharedT)))
+    {
+      return *linb::any_cast<SharedT>(cached.get());
+    }
+    T value{};
+    if(auto res = getInputStamped(key, value); !res)
+    {
+      return nonstd::make_unexpected(res.error());
+    }
+    auto shared = std::make_shared<const T>(std::move(value));
+    cacheLiteralPort(key, port_value_str, linb::any(SharedT(shared)));
+    return SharedT(std::move(shared));
   }
-  StringView remapped_key = remap_it->second;
-  if(remapped_key == "{=}" || remapped_key == "=")
+
+  const auto& blackboard = config().blackboard;
+  if(!blackboard)
   {
-    config().blackboard->set(static_cast<std::string>(key), value);
-    return {};
+    return nonstd::make_unexpected("getInputShared(): trying to access "
+                                   "an invalid Blackboard");
   }
+  try
+  {
+    auto entry = blackboard->getEntry(blackboard_key.value());
+    if(!entry)
+    {
+      return nonstd::make_unexpected(StrCat("getInputShared() failed because it was "
+                                            "unable to find the key [",
+                                            key, "] remapped to [",
+                                            blackboard_key.value(), "]"));
+    }
+    std::scoped_lock lk(entry->entry_mutex);
+    if(entry->value.empty())
+    {
+      return nonstd::make_unexpected(StrCat("getInputShared() failed because the key [",
+                                            blackboard_key.value(), "] has no value"));
+    }
+    // the converter matters only if the value is a string, see getConverted()
+    const StringConverter* converter = nullptr;
+    if(entry->value.isString() && port_info != nullptr && port_info->converter())
+    {
+      converter = &port_info->converter();
+    }
+    return Blackboard::getSnapshot<T>(*entry, converter, [&](const Any& any_value) -> T {
+      if(!std::is_same_v<T, std::string> && any_value.isString())
+      {
+        const auto str = any_value.cast<std::string>();
+        if(converter != nullptr)
+        {
+          return (*converter)(str).template cast<T>();
+        }
+        return parseString<T>(str);
+      }
+      auto result = blackboard->template tryCastWithPolymorphicFallback<T>(&any_value);
+      if(!result)
+      {
+        throw std::runtime_error(result.error());
+      }
+      return std::move(result.value());
+    });
+  }
+  catch(std::exception& err)
+  {
+    return nonstd::make_unexpected(err.what());
+  }
+}
+
+template <typename T>
+inline InputPortHandle<T> TreeNode::bindInput(const std::string& key) const
+{
+  InputPortHandle<T> handle;
+  handle.node_ = this;
+  handle.key_ = key;
 
-  if(!isBlackboardPointer(remapped_key))
+  auto port = resolveInputPort(key);
+  if(!port)
   {
-    return nonstd::make_unexpected("setOutput requires a blackboard pointer. Use {}");
+    handle.error_ = port.error();
+    return handle;
   }
 
-  if constexpr(std::is_same_v<BT::Any, T>)
+  auto blackboard_key = getRemappedKey(key, port->value);
+  if(port->default_value != nullptr || !blackboard_key)
   {
-    auto port_type = config().manifest->ports.at(key).type();
-    if(port_type != typeid(BT::Any) && port_type != typeid(BT::AnyTypeAllowed))
+    // literals and default values can not change: convert them now
+    T value{};
+    if(auto res = getInputStamped(key, value))
     {
-      throw LogicError("setOutput<Any> is not allowed, unless the port "
-                       "was declared using OutputPort<Any>");
+      handle.constant_ = std::move(value);
     }
+    else
+    {
+      handle.error_ = res.error();
+    }
+    return handle;
   }
 
-  remapped_key = stripBlackboardPointer(remapped_key);
-  config().blackboard->set(static_cast<std::string>(remapped_key), value);
+  handle.blackboard_key_ = std::string(blackboard_key.value());
+  if(port->info != nullptr && port->info->converter())
+  {
+    handle.converter_ = &port->info->converter();
+  }
+  return handle;
+}
 
+template <typename T>
+inline Expected<Timestamp> InputPortHandle<T>::get(T& destination) const
+{
+  if(!error_.empty())
+  {
+    return nonstd::make_unexpected(error_);
+  }
+  if(constant_)
+  {
+    destination = *constant_;
+    return Timestamp{};
+  }
+  if(node_ == nullptr)
+  {
+    return nonstd::make_unexpected("InputPortHandle: not bound to any port. "
+                                   "Use TreeNode::bindInput()");
+  }
+  const auto& blackboard = node_->config().blackboard;
+  if(!blackboard)
+  {
+    return nonstd::make_unexpected("getInput(): trying to access "
+                                   "an invalid Blackboard");
+  }
+
+  try
+  {
+    auto entry = entry_.lock();
+    if(!entry)
+    {
+      entry = blackboard->getEntry(blackboard_key_);
+      if(!entry)
+      {
+        return nonstd::make_unexpected(StrCat("getInput() failed because it was unable "
+                                              "to find the key [",
+                                              key_, "] remapped to [", blackboard_key_,
+                                              "]"));
+      }
+      entry_ = entry;
+    }
+
+    std::unique_lock lk(entry->entry_mutex);
+    const auto& any_value = entry->value;
+
+    if constexpr(std::is_same_v<T, Any>)
+    {
+      destination = any_value;
+      return Timestamp{ entry->sequence_id, entry->stamp };
+    }
+
+    if(any_value.empty())
+    {
+      return nonstd::make_unexpected(StrCat("getInput() failed because the key [",
+                                            blackboard_key_, "] has no value"));
+    }
+    if(!std::is_same_v<T, std::string> && any_value.isString())
+    {
+      auto value = Blackboard::getConverted<T>(*entry, converter_, [this](StringView str) -> T {
+        return converter_ ? (*converter_)(str).template cast<T>() :
+                            node_->template parseString<T>(std::string(str));
+      });
+      if(!value)
+      {
+        return nonstd::make_unexpected(value.error());
+      }
+      destination = std::move(value.value());
+    }
+    else
+    {
+      auto result = blackboard->template tryCastWithPolymorphicFallback<T>(&any_value);
+      if(!result)
+      {
+        return nonstd::make_unexpected(result.error());
+      }
+      destination = result.value();
+    }
+    return Timestamp{ entry->sequence_id, entry->stamp };
+  }
+  catch(std::exception& err)
+  {
+    return nonstd::make_unexpected(err.what());
+  }
+}
+
+template <typename T>
+inline Result TreeNode::setOutput(const std::string& key, const T& value)
+{
+  auto blackboard_key = getOutputBlackboardKey(key, std::is_same_v<BT::Any, T>);
+  if(!blackboard_key)
+  {
+    return nonstd::make_unexpected(blackboard_key.error());
+  }
+  config().blackboard->set(blackboard_key.value(), value);
+  return {};
+}
+
+template <typename T, typename>
+inline Result TreeNode::setOutput(const std::string& key, T&& value)
+{
+  auto blackboard_key = getOutputBlackboardKey(key, false);
+  if(!blackboard_key)
+  {
+    return nonstd::make_unexpected(blackboard_key.error());
+  }
+  config().blackboard->set(blackboard_key.value(), std::move(value));
   return {};
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -13,6 +14,9 @@ namespace BT::details
  * Callbacks enter the gate with tryStart() and must signal completion when done
  * (use Guard for RAII). During teardown, call close() to reject new callbacks
  * and closeAndDrain() to block until the callbacks still running have completed.
+ *
+ * tryStart() and the completion of a callback are lock-free: the mutex is used
+ * only while the gate is being closed.
  */
 class CallbackGate
 {
@@ -23,7 +27,7 @@ public:
   class Guard
   {
   public:
-    explicit Guard(Ptr gate) : gate_(std::move(gate))
+    explicit Guard(const Ptr& gate) : gate_(*gate)
     {}
 
     Guard(const Guard&) = delete;
@@ -33,55 +37,57 @@ public:
 
     ~Guard()
     {
-      gate_->completed();
+      gate_.completed();
     }
 
   private:
-    Ptr gate_;
+    CallbackGate& gate_;
   };
 
   /// Returns false if the gate has been closed and the callback must not run.
   bool tryStart()
   {
-    const std::lock_guard lk(mutex_);
+    // Register first, then check: closeAndDrain() either sees this callback
+    // as running, or this callback sees the gate closed.
+    running_callbacks_++;
     if(!accepting_callbacks_)
     {
+      completed();
       return false;
     }
-    running_callbacks_++;
     return true;
   }
 
   /// Reject new callbacks, without waiting for the running ones.
   void close()
   {
-    const std::lock_guard lk(mutex_);
     accepting_callbacks_ = false;
   }
 
   /// Reject new callbacks and wait until callbacks already running have completed.
   void closeAndDrain()
   {
-    std::unique_lock lk(mutex_);
     accepting_callbacks_ = false;
+    std::unique_lock lk(mutex_);
     condition_variable_.wait(lk, [this] { return running_callbacks_ == 0; });
   }
 
 private:
   void completed()
   {
-    const std::lock_guard lk(mutex_);
-    running_callbacks_--;
-    if(running_callbacks_ == 0 && !accepting_callbacks_)
+    if(--running_callbacks_ == 0 && !accepting_callbacks_)
     {
+      // Taking the mutex guarantees that closeAndDrain() is either still
+      // evaluating its predicate or already waiting for this notification.
+      const std::lock_guard lk(mutex_);
       condition_variable_.notify_all();
     }
   }
 
   std::mutex mutex_;
   std::condition_variable condition_variable_;
-  bool accepting_callbacks_ = true;
-  size_t running_callbacks_ = 0;
+  std::atomic_bool accepting_callbacks_ = true;
+  std::atomic_size_t running_callbacks_ = 0;
 };
 
 }  // namespace BT::details
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "behaviortree_cpp/basic_types.h"
+#include "behaviortree_cpp/utils/wakeup_signal.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace BT
+{
+
+/**
+ * @brief Source of time of a Tree, see Tree::setClock().
+ *
+ * It provides the timestamps of the status changes (used by the loggers),
+ * the sleep of Tree::sleep() and Tree::tickWhileRunning() and, if it is
+ * simulated, the time of the TimerQueues (SleepNode, DelayNode, TimeoutNode,
+ * TestNode).
+ *
+ * The default one, Clock::realTime(), uses the high_resolution_clock.
+ */
+class Clock
+{
+public:
+  /**
+   * @brief Object executing actions at a given time, such as a TimerQueue.
+   * A simulated clock executes them when its time is advanced.
+   */
+  class Scheduler
+  {
+  public:
+    virtual ~Scheduler() = default;
+
+    /// Time of the next action, if any.
+    [[nodiscard]] virtual std::optional<TimePoint> nextTime() = 0;
+
+    /// Execute the actions scheduled at or before the given time.
+    virtual void executeUntil(TimePoint time) = 0;
+  };
+
+  virtual ~Clock() = default;
+
+  [[nodiscard]] virtual TimePoint now() const = 0;
+
+  /// Wait for the timeout, unless the signal is emitted earlier.
+  /// Return true if the signal was received.
+  virtual bool sleepFor(WakeUpSignal& signal, Duration timeout) = 0;
+
+  /**
+   * @brief A simulated clock advances only when it is requested to (for
+   * instance by sleepFor()) and it executes the actions of its Schedulers.
+   * Otherwise, the clock is supposed to advance in real time, and the
+   * TimerQueues use the steady_clock.
+   */
+  [[nodiscard]] virtual bool isSimulated() const
+  {
+    return false;
+  }
+
+  /// Used only if isSimulated(). The scheduler must be removed before its destruction.
+  virtual void addScheduler(Scheduler* scheduler);
+
+  virtual void removeScheduler(Scheduler* scheduler);
+
+  /// Shared instance of the real-time clock.
+  [[nodiscard]] static const std::shared_ptr<Clock>& realTime();
+};
+
+/**
+ * @brief Discrete-event clock: its time changes only when sleepFor(),
+ * advance() or advanceTo() are invoked, and it jumps directly to the next
+ * timer that expires. Trees can be executed as fast as possible and
+ * their results do not depend on the speed of the computer.
+ *
+ * The handlers of the timers are executed by the thread that advances
+ * the time, in chronological order.
+ *
+ * NOTE: ThreadedActions and other nodes using their own threads or
+ * std::chrono clocks directly are not affected.
+ */
+class SimulatedClock : public Clock
+{
+public:
+  explicit SimulatedClock(TimePoint start_time = {});
+
+  [[nodiscard]] TimePoint now() const override;
+
+  /// Advance the time to the next timer, until the signal is received
+  /// or the timeout is elapsed. With a zero timeout, jump to the next timer.
+  bool sleepFor(WakeUpSignal& signal, Duration timeout) override;
+
+  [[nodiscard]] bool isSimulated() const override
+  {
+    return true;
+  }
+
+  void addScheduler(Scheduler* scheduler) override;
+
+  void removeScheduler(Scheduler* scheduler) override;
+
+  /// Advance the time, executing all the timers that expire in the meantime.
+  void advance(Duration duration);
+
+  void advanceTo(TimePoint time);
+
+private:
+  // time of the first action of the schedulers, if any
+  std::optional<TimePoint> nextTime();
+
+  // return true if the signal was received
+  bool advanceTo(TimePoint time, WakeUpSignal* signal);
+
+  std::atomic<Duration::rep> time_since_epoch_;
+  std::recursive_mutex schedulers_mutex_;
+  std::vector<Scheduler*> schedulers_;
+};
+
+}  // namespace BT
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "behaviortree_cpp/blackboard.h"
+#include "behaviortree_cpp/tree_node.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace BT
+{
+
+/**
+ * @brief A blackboard entry, read again only when it is updated.
+ *
+ * The updates are detected through the sequence_id of the entry: values
+ * modified in place with Blackboard::getAnyLocked() don't change it.
+ */
+struct WatchedEntry
+{
+  std::string key;
+  std::shared_ptr<Blackboard::Entry> entry;
+  uint64_t sequence_id = 0;
+
+  /**
+   * @brief Find the entry and read its sequence_id: true if it was updated
+   * (or removed and created again) since the previous call.
+   *
+   * A missing entry is always considered changed and leaves "entry" empty.
+   * The sequence_id is read before the caller uses the value: a value written
+   * in the meantime is noticed by the next call.
+   */
+  bool changed(const Blackboard::Ptr& blackboard);
+};
+
+/**
+ * @brief Results of the ConditionNodes children of a control node,
+ * replayed while the blackboard entries they read are not updated.
+ *
+ * It is used by ReactiveSequence and ReactiveFallback, when the
+ * incremental evaluation is enabled.
+ *
+ * A child is cached only if:
+ *
+ * - it is a ConditionNode, without pre-conditions or post-conditions;
+ * - it has no output ports;
+ * - at least one of its input ports is remapped to a blackboard entry.
+ *
+ * The cached result is replayed until the sequence_id of any of those entries
+ * changes (or the entry is removed and created again). It is, therefore,
+ * valid only if the condition depends exclusively on its input ports:
+ * nothing else, such as a sensor read directly, should affect its result.
+ * Values modified in place with Blackboard::getAnyLocked() don't change
+ * the sequence_id, either.
+ */
+class ConditionCache
+{
+public:
+  /// Forget all the results.
+  void clear();
+
+  /**
+   * @brief Tick the child at the given index, unless it is cached and
+   * none of its inputs changed since its last tick: in that case
+   * the previous status is returned, without ticking it.
+   */
+  NodeStatus executeTick(size_t index, TreeNode& child);
+
+private:
+  struct Item
+  {
+    bool initialized = false;
+    bool cacheable = false;
+    // true if all the entries were found, the last time they were read
+    bool complete = false;
+    NodeStatus status = NodeStatus::IDLE;
+    std::vector<WatchedEntry> inputs;
+  };
+
+  std::vector<Item> items_;
+
+  static void initialize(Item& item, const TreeNode& child);
+
+  // Read the sequence_id of the inputs; true if none of them changed.
+  static bool inputsUnchanged(Item& item, const TreeNode& child);
+};
+
+}  // namespace BT
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace BT::details
+{
+
+/**
+ * @brief Log-linear histogram of durations in microseconds, in the style of
+ * HdrHistogram: values smaller than 2*kSubBuckets are counted exactly, larger
+ * values are grouped in kSubBuckets buckets per power of two.
+ *
+ * record() is wait-free; snapshot() and reset() can be called concurrently,
+ * at the cost of possibly missing the samples recorded in the meantime.
+ */
+class DurationHistogram
+{
+public:
+  static constexpr uint64_t kSubBuckets = 16;
+  // larger durations (about 71 minutes) are clamped
+  static constexpr uint64_t kMaxValue = (uint64_t(1) << 32) - 1;
+  // kMaxValue has 32 significant bits: 28 powers of two above 2*kSubBuckets,
+  // plus the exact buckets
+  static constexpr size_t kBucketsCount = 29 * kSubBuckets;
+
+  struct Statistics
+  {
+    // number of samples recorded
+    uint64_t count = 0;
+    // percentiles have a relative error lower than 1/16 above 32 usec
+    std::chrono::microseconds p50 = {};
+    std::chrono::microseconds p99 = {};
+    std::chrono::microseconds max = {};
+    std::chrono::microseconds mean = {};
+  };
+
+  void record(uint64_t value)
+  {
+    value = std::min(value, kMaxValue);
+    buckets_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+
+    auto prev_max = max_.load(std::memory_order_relaxed);
+    while(prev_max < value &&
+          !max_.compare_exchange_weak(prev_max, value, std::memory_order_relaxed))
+    {}
+  }
+
+  void reset()
+  {
+    for(auto& bucket : buckets_)
+    {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] Statistics snapshot() const
+  {
+    std::array<uint64_t, kBucketsCount> counts;
+    uint64_t total = 0;
+    for(size_t i = 0; i < kBucketsCount; i++)
+    {
+      counts[i] = buckets_[i].load(std::memory_order_relaxed);
+      total += counts[i];
+    }
+
+    Statistics stats;
+    if(total == 0)
+    {
+      return stats;
+    }
+    const uint64_t max_value = max_.load(std::memory_order_relaxed);
+
+    auto percentile = [&](double quantile) {
+      // smallest value such that at least quantile*total samples are not larger
+      const auto rank = std::max<uint64_t>(1, uint64_t(std::ceil(quantile * total)));
+      uint64_t cumulative = 0;
+      for(size_t i = 0; i < kBucketsCount; i++)
+      {
+        cumulative += counts[i];
+        if(cumulative >= rank)
+        {
+          return std::chrono::microseconds(std::min(bucketUpperValue(i), max_value));
+        }
+      }
+      return std::chrono::microseconds(max_value);
+    };
+
+    stats.count = total;
+    stats.p50 = percentile(0.50);
+    stats.p99 = percentile(0.99);
+    stats.max = std::chrono::microseconds(max_value);
+    stats.mean = std::chrono::microseconds(sum_.load(std::memory_order_relaxed) / total);
+    return stats;
+  }
+
+  static constexpr size_t bucketIndex(uint64_t value)
+  {
+    uint64_t shift = 0;
+    while(value >= 2 * kSubBuckets)
+    {
+      value >>= 1;
+      shift++;
+    }
+    return size_t(shift * kSubBuckets + value);
+  }
+
+  static constexpr uint64_t bucketUpperValue(size_t index)
+  {
+    if(index < 2 * kSubBuckets)
+    {
+      return index;
+    }
+    const uint64_t shift = index / kSubBuckets - 1;
+    const uint64_t sub_bucket = index % kSubBuckets + kSubBuckets;
+    return ((sub_bucket + 1) << shift) - 1;
+  }
+
+private:
+  std::array<std::atomic<uint64_t>, kBucketsCount> buckets_ = {};
+  std::atomic<uint64_t> sum_ = 0;
+  std::atomic<uint64_t> max_ = 0;
+};
+
+static_assert(DurationHistogram::bucketIndex(DurationHistogram::kMaxValue) <
+              DurationHistogram::kBucketsCount);
+static_assert(DurationHistogram::bucketUpperValue(DurationHistogram::kBucketsCount - 1) ==
+              DurationHistogram::kMaxValue);
+
+}  // namespace BT::details
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace BT
+{
+
+/**
+ * @brief Unbounded lock-free queue, with multiple producers and a single consumer.
+ *
+ * Any number of threads can push() concurrently, without blocking each other
+ * or the consumer; only one thread at a time may call tryPop() and empty().
+ *
+ * It can be used as the "queue" of a LoopNode, to feed it from other threads:
+ *
+ *    auto queue = std::make_shared<MPSCQueue<int>>();
+ *    blackboard->set("queue", queue);
+ *    // in the producer threads
+ *    queue->push(42);
+ *
+ * NOTE: a push() is visible to the consumer when it returns; tryPop() may
+ * return nothing while a push() started earlier is still in progress.
+ */
+template <typename T>
+class MPSCQueue
+{
+public:
+  MPSCQueue() : head_(new Node), tail_(head_.load(std::memory_order_relaxed))
+  {}
+
+  ~MPSCQueue()
+  {
+    while(tail_ != nullptr)
+    {
+      Node* next = tail_->next.load(std::memory_order_relaxed);
+      delete tail_;
+      tail_ = next;
+    }
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+  MPSCQueue(MPSCQueue&&) = delete;
+  MPSCQueue& operator=(MPSCQueue&&) = delete;
+
+  /// Thread-safe, can be called by any thread.
+  void push(T value)
+  {
+    auto* node = new Node;
+    node->value.emplace(std::move(value));
+    Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+  }
+
+  /// Pop the oldest element, if any. Consumer thread only.
+  std::optional<T> tryPop()
+  {
+    Node* next = tail_->next.load(std::memory_order_acquire);
+    if(next == nullptr)
+    {
+      return std::nullopt;
+    }
+    // "next" becomes the new (empty) sentinel
+    std::optional<T> value = std::move(next->value);
+    next->value.reset();
+    delete tail_;
+    tail_ = next;
+    return value;
+  }
+
+  /// Consumer thread only.
+  [[nodiscard]] bool empty() const
+  {
+    return tail_->next.load(std::memory_order_acquire) == nullptr;
+  }
+
+private:
+  struct Node
+  {
+    std::atomic<Node*> next{ nullptr };
+    std::optional<T> value;
+  };
+
+  // last node pushed, shared by the producers
+  std::atomic<Node*> head_;
+  // sentinel preceding the oldest element, owned by the consumer
+  Node* tail_;
+};
+
+template <typename T>
+using SharedMPSCQueue = std::shared_ptr<MPSCQueue<T>>;
+
+}  // namespace BT
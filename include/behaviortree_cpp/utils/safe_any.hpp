@@ -25,6 +25,7 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <typeindex>
 
@@ -33,6 +34,11 @@ namespace BT
 
 static std::type_index UndefinedAnyType = typeid(nullptr);
 
+#if __cpp_lib_to_chars < 201611L
+// Declared in basic_types.h. Replaces the floating-point std::from_chars.
+bool parseDouble(std::string_view str, double& out, bool require_full_consumption);
+#endif
+
 // Trait to detect std::shared_ptr types (used for polymorphic port support)
 template <typename T>
 struct is_shared_ptr : std::false_type
@@ -44,6 +50,22 @@ struct is_shared_ptr<std::shared_ptr<U>> : std::true_type
 {
 };
 
+class Any;
+
+// True for the types that Any stores as they are, and that can therefore be
+// moved into it. Numbers and strings are always converted, instead.
+template <typename T>
+struct is_movable_into_any
+  : std::integral_constant<
+        bool, !std::is_reference<T>::value && !std::is_const<T>::value &&
+                  !std::is_arithmetic<T>::value && !std::is_enum<T>::value &&
+                  !std::is_constructible<std::string_view, T>::value &&
+                  !std::is_same<T, SafeAny::SimpleString>::value &&
+                  !std::is_same<T, std::type_index>::value &&
+                  !std::is_same<T, Any>::value>
+{
+};
+
 // Rational: since type erased numbers will always use at least 8 bytes
 // it is faster to cast everything to either double, uint64_t or int64_t.
 class Any
@@ -129,6 +151,11 @@ public:
     static_assert(!std::is_reference<T>::value, "Any can not contain references");
   }
 
+  // custom types passed as rvalue are moved, not copied
+  template <typename T, typename = std::enable_if_t<is_movable_into_any<T>::value>>
+  explicit Any(T&& value) : _any(std::move(value)), _original_type(typeid(T))
+  {}
+
   Any& operator=(const Any& other);
 
   Any& operator=(Any&& other) noexcept;
@@ -152,6 +179,9 @@ public:
   // copy the value (casting into dst). We preserve the destination type.
   void copyInto(Any& dst) const;
 
+  // same as copyInto, but the value is moved if it doesn't need to be casted.
+  void moveInto(Any& dst);
+
   // this is different from any_cast, because if allows safe
   // conversions between arithmetic values and from/to string.
   template <typename T>
@@ -400,6 +430,22 @@ inline void Any::copyInto(Any& dst) const
   }
 }
 
+inline void Any::moveInto(Any& dst)
+{
+  if(dst.empty())
+  {
+    dst = std::move(*this);
+  }
+  else if((castedType() == dst.castedType()) || (isString() && dst.isString()))
+  {
+    dst._any = std::move(_any);
+  }
+  else
+  {
+    copyInto(dst);
+  }
+}
+
 template <typename DST>
 inline nonstd::expected<DST, std::string> Any::convert(EnableString<DST>) const
 {
@@ -431,42 +477,30 @@ inline nonstd::expected<T, std::string> Any::stringToNumber() const
   static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "Expecting a "
                                                                      "numeric type");
 
-  const auto str = linb::any_cast<SafeAny::SimpleString>(_any);
-#if __cpp_lib_to_chars >= 201611L
+  const auto& str = *linb::any_cast<SafeAny::SimpleString>(&_any);
   T out;
-  auto [ptr, err] = std::from_chars(str.data(), str.data() + str.size(), out);
-  if(err == std::errc())
-  {
-    return out;
-  }
-  else
+#if __cpp_lib_to_chars < 201611L
+  // the floating-point std::from_chars is not available
+  if constexpr(std::is_floating_point_v<T>)
   {
+    double value = 0;
+    if(parseDouble(std::string_view(str.data(), str.size()), value, false))
+    {
+      return static_cast<T>(value);
+    }
     return nonstd::make_unexpected("Any failed string to number conversion");
   }
-#else
-  try
+  else
+#endif
   {
-    if constexpr(std::is_same_v<T, uint16_t>)
-    {
-      return std::stoul(str.toStdString());
-    }
-    if constexpr(std::is_integral_v<T>)
-    {
-      const int64_t val = std::stol(str.toStdString());
-      Any temp_any(val);
-      return temp_any.convert<T>();
-    }
-    if constexpr(std::is_floating_point_v<T>)
+    auto [ptr, err] = std::from_chars(str.data(), str.data() + str.size(), out);
+    std::ignore = ptr;
+    if(err == std::errc())
     {
-      return std::stod(str.toStdString());
+      return out;
     }
   }
-  catch(...)
-  {
-    return nonstd::make_unexpected("Any failed string to number conversion");
-  }
-#endif
-  return nonstd::make_unexpected("Any conversion from string failed");
+  return nonstd::make_unexpected("Any failed string to number conversion");
 }
 
 template <typename DST>
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BT
+{
+
+/**
+ * @brief Minimal fixed-size pool of worker threads, executing the tasks
+ * in the order they were posted.
+ *
+ * It is used by the ConcurrentParallelNode to tick its children.
+ * Tasks must not throw: exceptions should be captured by the task itself
+ * (for instance with std::exception_ptr) and reported to the caller.
+ */
+class ThreadPool
+{
+public:
+  /// @param threads number of worker threads (at least 1)
+  explicit ThreadPool(size_t threads);
+
+  /// Wait for the tasks already posted to be completed, then join the threads.
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  void post(std::function<void()> task);
+
+  [[nodiscard]] size_t size() const
+  {
+    return workers_.size();
+  }
+
+  /// Pool shared by the whole process, with one thread for each core.
+  /// Created the first time it is used.
+  static ThreadPool& shared();
+
+private:
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_ = false;
+
+  void workerLoop();
+};
+
+}  // namespace BT
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace BT
+{
+
+/**
+ * @brief Deadline of the current tick, shared by all the nodes of a Tree.
+ * It is active only during Tree::tickOnceUntil().
+ *
+ * Control nodes that can resume from the child they stopped at (Sequence,
+ * SequenceWithMemory, Fallback) check it between children, using
+ * TreeNode::tickDeadlineExpired(), and return RUNNING if it was exceeded.
+ *
+ * The node whose tick() was executing when the deadline expired records
+ * an overrun.
+ *
+ * start() and stop() are invoked by the thread ticking the tree; the other
+ * methods are thread-safe, since the children of a ConcurrentParallel
+ * are ticked by worker threads.
+ */
+class TickDeadline
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  void start(Clock::time_point deadline)
+  {
+    deadline_.store(deadline, std::memory_order_relaxed);
+    expired_.store(false, std::memory_order_relaxed);
+    active_.store(true, std::memory_order_release);
+  }
+
+  void stop()
+  {
+    active_.store(false, std::memory_order_relaxed);
+    expired_.store(false, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] bool active() const
+  {
+    return active_.load(std::memory_order_acquire);
+  }
+
+  /// True if the deadline is active and it was reached.
+  [[nodiscard]] bool expired()
+  {
+    if(expired_.load(std::memory_order_relaxed))
+    {
+      return true;
+    }
+    if(active() && Clock::now() >= deadline_.load(std::memory_order_relaxed))
+    {
+      expired_.store(true, std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+  /// Invoked at the end of the tick() of a node, at time "now".
+  void checkOverrun(uint32_t uid, Clock::time_point now)
+  {
+    if(!active() || now < deadline_.load(std::memory_order_relaxed))
+    {
+      return;
+    }
+    // only the first node noticing the expiration records the overrun
+    bool already_expired = false;
+    if(expired_.compare_exchange_strong(already_expired, true, std::memory_order_relaxed))
+    {
+      const std::scoped_lock lk(overruns_mutex_);
+      if(uid >= overruns_.size())
+      {
+        overruns_.resize(size_t(uid) + 1, 0);
+      }
+      overruns_[uid]++;
+    }
+  }
+
+  /// Number of overruns of each node, indexed by TreeNode::UID().
+  [[nodiscard]] std::vector<uint64_t> overruns() const
+  {
+    const std::scoped_lock lk(overruns_mutex_);
+    return overruns_;
+  }
+
+  void clearOverruns()
+  {
+    const std::scoped_lock lk(overruns_mutex_);
+    overruns_.clear();
+  }
+
+private:
+  std::atomic<Clock::time_point> deadline_{ Clock::time_point{} };
+  std::atomic_bool active_ = false;
+  std::atomic_bool expired_ = false;
+  // written only when an overrun happens
+  mutable std::mutex overruns_mutex_;
+  std::vector<uint64_t> overruns_;
+};
+
+}  // namespace BT
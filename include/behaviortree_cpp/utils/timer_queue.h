@@ -1,10 +1,13 @@
 #pragma once
 
+#include "behaviortree_cpp/utils/clock.h"
+
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <thread>
 
@@ -72,9 +75,13 @@ private:
 //  - Handlers are ALWAYS executed in the Timer Queue worker thread.
 //  - Handlers execution order is NOT guaranteed
 //
+// With a simulated BT::Clock (see setClock()), the timers expire when its
+// time is advanced, and their handlers are executed by the thread advancing
+// it. Canceled handlers are still executed in the Timer Queue worker thread.
+//
 template <typename ClockT = std::chrono::steady_clock,
           typename DurationT = std::chrono::steady_clock::duration>
-class TimerQueue
+class TimerQueue : public Clock::Scheduler
 {
 public:
   TimerQueue()
@@ -83,8 +90,9 @@ public:
     m_thread = std::thread([this]() { run(); });
   }
 
-  ~TimerQueue()
+  ~TimerQueue() override
   {
+    setClock(nullptr);
     m_finish.store(true);
     cancelAll();
     if(m_thread.joinable())
@@ -100,10 +108,10 @@ public:
   uint64_t add(std::chrono::milliseconds milliseconds, std::function<void(bool)> handler)
   {
     WorkItem item;
-    item.end = ClockT::now() + milliseconds;
     item.handler = std::move(handler);
 
     std::unique_lock<std::mutex> lk(m_mtx);
+    item.end = now() + milliseconds;
     uint64_t id = ++m_idcounter;
     item.id = id;
     m_items.push(std::move(item));
@@ -132,8 +140,8 @@ public:
       if(item.id == id && item.handler)
       {
         WorkItem newItem;
-        // Zero time, so it stays at the top for immediate execution
-        newItem.end = std::chrono::time_point<ClockT, DurationT>();
+        // Minimum time, so it stays at the top for immediate execution
+        newItem.end = TimePointT::min();
         newItem.id = 0;  // Means it is a canceled item
         // Move the handler from item to newItem.
         // Also, we need to manually set the handler to nullptr, since
@@ -165,7 +173,7 @@ public:
     {
       if(item.id)
       {
-        item.end = std::chrono::time_point<ClockT, DurationT>();
+        item.end = TimePointT::min();
         item.id = 0;
       }
     }
@@ -176,18 +184,86 @@ public:
     return ret;
   }
 
+  /**
+   * @brief Use the time of a simulated clock, instead of ClockT.
+   * A clock that is not simulated (or nullptr) restores ClockT.
+   *
+   * It should be changed only when there are no pending timers.
+   */
+  void setClock(std::shared_ptr<Clock> clock)
+  {
+    if(clock && !clock->isSimulated())
+    {
+      clock.reset();
+    }
+    std::unique_lock<std::mutex> lk(m_mtx);
+    if(clock == m_clock)
+    {
+      return;
+    }
+    std::swap(clock, m_clock);
+    lk.unlock();
+
+    // clock now contains the previous one
+    if(clock)
+    {
+      clock->removeScheduler(this);
+    }
+    if(m_clock)
+    {
+      m_clock->addScheduler(this);
+    }
+    m_checkWork.notify();
+  }
+
+  std::optional<TimePoint> nextTime() override
+  {
+    auto next = calcWaitTime();
+    if(!next.first)
+    {
+      return std::nullopt;
+    }
+    return TimePoint(std::chrono::duration_cast<Duration>(next.second.time_since_epoch()));
+  }
+
+  void executeUntil(TimePoint time) override
+  {
+    checkWork(TimePointT(std::chrono::duration_cast<DurationT>(time.time_since_epoch())));
+  }
+
   TimerQueue(const TimerQueue&) = delete;
   TimerQueue& operator=(const TimerQueue&) = delete;
   TimerQueue(TimerQueue&&) = delete;
   TimerQueue& operator=(TimerQueue&&) = delete;
 
 private:
+  using TimePointT = std::chrono::time_point<ClockT, DurationT>;
+
+  // must be called while holding m_mtx
+  TimePointT now() const
+  {
+    if(m_clock)
+    {
+      return TimePointT(
+          std::chrono::duration_cast<DurationT>(m_clock->now().time_since_epoch()));
+    }
+    return ClockT::now();
+  }
+
+  bool simulated()
+  {
+    const std::lock_guard<std::mutex> lk(m_mtx);
+    return bool(m_clock);
+  }
+
   void run()
   {
     while(!m_finish.load())
     {
+      // with a simulated clock, only the canceled timers are executed here
+      const bool simulated_clock = simulated();
       auto end = calcWaitTime();
-      if(end.first)
+      if(end.first && !simulated_clock)
       {
         // Timers found, so wait until it expires (or something else
         // changes)
@@ -200,8 +276,8 @@ private:
       }
 
       // Check and execute as much work as possible, such as, all expired
-      // timers
-      checkWork();
+      // timers. The clock might have been changed in the meantime.
+      checkWork(std::nullopt);
     }
 
     // If we are shutting down, we should not have any items left,
@@ -209,7 +285,7 @@ private:
     assert(m_items.size() == 0);
   }
 
-  std::pair<bool, std::chrono::time_point<ClockT, DurationT>> calcWaitTime()
+  std::pair<bool, TimePointT> calcWaitTime()
   {
     std::lock_guard<std::mutex> lk(m_mtx);
     while(m_items.size())
@@ -228,13 +304,24 @@ private:
 
     // No items found, so return no wait time (causes the thread to wait
     // indefinitely)
-    return std::make_pair(false, std::chrono::time_point<ClockT, DurationT>());
+    return std::make_pair(false, TimePointT());
   }
 
-  void checkWork()
+  // execute the timers expired at the given time. If it is not given, use
+  // the current time of ClockT or, with a simulated clock, execute only the
+  // canceled timers: the others expire when the simulated time is advanced.
+  void checkWork(std::optional<TimePointT> time)
   {
+    // must be called while holding m_mtx
+    auto limit = [&]() {
+      if(time)
+      {
+        return *time;
+      }
+      return m_clock ? TimePointT::min() : ClockT::now();
+    };
     std::unique_lock<std::mutex> lk(m_mtx);
-    while(m_items.size() && m_items.top().end <= ClockT::now())
+    while(m_items.size() && m_items.top().end <= limit())
     {
       WorkItem item(std::move(m_items.top()));
       m_items.pop();
@@ -252,10 +339,12 @@ private:
   std::thread m_thread;
   std::atomic_bool m_finish = false;
   uint64_t m_idcounter = 0;
+  // simulated clock, if any
+  std::shared_ptr<Clock> m_clock;
 
   struct WorkItem
   {
-    std::chrono::time_point<ClockT, DurationT> end;
+    TimePointT end;
     uint64_t id = 0;  // id==0 means it was cancelled
     std::function<void(bool)> handler;
     bool operator>(const WorkItem& other) const
@@ -24,6 +24,7 @@ NodeStatus SleepNode::onStart()
 
   timer_waiting_ = true;
 
+  timer_.setClock(clock());
   timer_id_ = timer_.add(std::chrono::milliseconds(msec), [this](bool aborted) {
     const std::unique_lock<std::mutex> lk(delay_mutex_);
     if(!aborted)
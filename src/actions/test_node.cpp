@@ -133,6 +133,7 @@ NodeStatus TestNode::onStart()
   // convert this in an asynchronous operation. Use another thread to count
   // a certain amount of time.
   _p->completed = false;
+  _p->timer.setClock(clock());
   _p->timer.add(std::chrono::milliseconds(_p->config->async_delay), [this](bool aborted) {
     if(!aborted)
     {
@@ -127,81 +127,143 @@ std::string convertFromString<std::string>(StringView str)
   return std::string(str.data(), str.size());
 }
 
-template <>
-int64_t convertFromString<int64_t>(StringView str)
+namespace
 {
-  int64_t result = 0;
-  const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
-  std::ignore = ptr;
-  if(ec != std::errc())
+// Throw the error of a failed conversion, as expected from convertFromString
+template <typename T>
+T ValueOrThrow(Expected<T>&& result)
+{
+  if(!result)
   {
-    throw RuntimeError(StrCat("Can't convert string [", str, "] to integer"));
+    throw RuntimeError(result.error());
   }
-  return result;
+  return std::move(result.value());
 }
 
-template <>
-uint64_t convertFromString<uint64_t>(StringView str)
+template <typename T>
+Expected<T> ParseInteger(StringView str)
 {
-  uint64_t result = 0;
+  T result = 0;
   const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
   std::ignore = ptr;
   if(ec != std::errc())
   {
-    throw RuntimeError(StrCat("Can't convert string [", str, "] to integer"));
+    return nonstd::make_unexpected(StrCat("Can't convert string [", str, "] to integer"));
   }
   return result;
 }
 
-namespace
-{
 template <typename T>
-T ConvertWithBoundCheck(StringView str)
+Expected<T> ParseIntegerWithBoundCheck(StringView str)
 {
-  auto res = convertFromString<int64_t>(str);
-  if(res < std::numeric_limits<T>::lowest() || res > std::numeric_limits<T>::max())
+  auto res = ParseInteger<int64_t>(str);
+  if(!res)
+  {
+    return nonstd::make_unexpected(res.error());
+  }
+  if(*res < std::numeric_limits<T>::lowest() || *res > std::numeric_limits<T>::max())
   {
-    throw RuntimeError(
+    return nonstd::make_unexpected(
         StrCat("Value out of bound when converting [", str, "] to integer"));
   }
-  return res;
+  return static_cast<T>(*res);
 }
 }  // namespace
 
+template <>
+Expected<int8_t> tryConvertFromString<int8_t>(StringView str)
+{
+  return ParseIntegerWithBoundCheck<int8_t>(str);
+}
+
+template <>
+Expected<int16_t> tryConvertFromString<int16_t>(StringView str)
+{
+  return ParseIntegerWithBoundCheck<int16_t>(str);
+}
+
+template <>
+Expected<int32_t> tryConvertFromString<int32_t>(StringView str)
+{
+  return ParseIntegerWithBoundCheck<int32_t>(str);
+}
+
+template <>
+Expected<int64_t> tryConvertFromString<int64_t>(StringView str)
+{
+  return ParseInteger<int64_t>(str);
+}
+
+template <>
+Expected<uint8_t> tryConvertFromString<uint8_t>(StringView str)
+{
+  return ParseIntegerWithBoundCheck<uint8_t>(str);
+}
+
+template <>
+Expected<uint16_t> tryConvertFromString<uint16_t>(StringView str)
+{
+  return ParseIntegerWithBoundCheck<uint16_t>(str);
+}
+
+template <>
+Expected<uint32_t> tryConvertFromString<uint32_t>(StringView str)
+{
+  return ParseIntegerWithBoundCheck<uint32_t>(str);
+}
+
+template <>
+Expected<uint64_t> tryConvertFromString<uint64_t>(StringView str)
+{
+  return ParseInteger<uint64_t>(str);
+}
+
 template <>
 int8_t convertFromString<int8_t>(StringView str)
 {
-  return ConvertWithBoundCheck<int8_t>(str);
+  return ValueOrThrow(tryConvertFromString<int8_t>(str));
 }
 
 template <>
 int16_t convertFromString<int16_t>(StringView str)
 {
-  return ConvertWithBoundCheck<int16_t>(str);
+  return ValueOrThrow(tryConvertFromString<int16_t>(str));
 }
 
 template <>
 int32_t convertFromString<int32_t>(StringView str)
 {
-  return ConvertWithBoundCheck<int32_t>(str);
+  return ValueOrThrow(tryConvertFromString<int32_t>(str));
+}
+
+template <>
+int64_t convertFromString<int64_t>(StringView str)
+{
+  return ValueOrThrow(tryConvertFromString<int64_t>(str));
 }
 
 template <>
 uint8_t convertFromString<uint8_t>(StringView str)
 {
-  return ConvertWithBoundCheck<uint8_t>(str);
+  return ValueOrThrow(tryConvertFromString<uint8_t>(str));
 }
 
 template <>
 uint16_t convertFromString<uint16_t>(StringView str)
 {
-  return ConvertWithBoundCheck<uint16_t>(str);
+  return ValueOrThrow(tryConvertFromString<uint16_t>(str));
 }
 
 template <>
 uint32_t convertFromString<uint32_t>(StringView str)
 {
-  return ConvertWithBoundCheck<uint32_t>(str);
+  return ValueOrThrow(tryConvertFromString<uint32_t>(str));
+}
+
+template <>
+uint64_t convertFromString<uint64_t>(StringView str)
+{
+  return ValueOrThrow(tryConvertFromString<uint64_t>(str));
 }
 
 bool parseDouble(StringView str, double& out, bool require_full_consumption)
@@ -271,90 +333,130 @@ bool parseDouble(StringView str, double& out, bool require_full_consumption)
 }
 
 template <>
-double convertFromString<double>(StringView str)
+Expected<double> tryConvertFromString<double>(StringView str)
 {
   double result = 0;
   if(!parseDouble(str, result, /*require_full_consumption=*/false))
   {
-    throw RuntimeError(StrCat("Can't convert string [", str, "] to double"));
+    return nonstd::make_unexpected(StrCat("Can't convert string [", str, "] to double"));
   }
   return result;
 }
 
 template <>
-float convertFromString<float>(StringView str)
+Expected<float> tryConvertFromString<float>(StringView str)
 {
 #if __cpp_lib_to_chars >= 201611L
   // Parse directly as float to preserve std::from_chars<float> range semantics.
   float result = 0;
   const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+  std::ignore = ptr;
   if(ec != std::errc())
   {
-    throw RuntimeError(StrCat("Can't convert string [", str, "] to float"));
+    return nonstd::make_unexpected(StrCat("Can't convert string [", str, "] to float"));
   }
   return result;
 #else
   double result = 0;
   if(!parseDouble(str, result, /*require_full_consumption=*/false))
   {
-    throw RuntimeError(StrCat("Can't convert string [", str, "] to float"));
+    return nonstd::make_unexpected(StrCat("Can't convert string [", str, "] to float"));
   }
   return static_cast<float>(result);
 #endif
 }
 
 template <>
-std::vector<int> convertFromString<std::vector<int>>(StringView str)
+double convertFromString<double>(StringView str)
+{
+  return ValueOrThrow(tryConvertFromString<double>(str));
+}
+
+template <>
+float convertFromString<float>(StringView str)
+{
+  return ValueOrThrow(tryConvertFromString<float>(str));
+}
+
+namespace
+{
+// Values separated by the character ";", or a JSON array with the prefix "json:"
+template <typename T>
+Expected<std::vector<T>> ParseVector(StringView str)
 {
   if(StartWith(str, "json:"))
   {
     str.remove_prefix(5);
-    return nlohmann::json::parse(str).get<std::vector<int>>();
+    const auto json = nlohmann::json::parse(str, nullptr, /*allow_exceptions=*/false);
+    if(json.is_discarded())
+    {
+      return nonstd::make_unexpected(StrCat("Can't parse the JSON array [", str, "]"));
+    }
+    try
+    {
+      return json.get<std::vector<T>>();
+    }
+    catch(std::exception& ex)
+    {
+      return nonstd::make_unexpected(ex.what());
+    }
   }
-  auto parts = splitString(str, ';');
-  std::vector<int> output;
-  output.reserve(parts.size());
-  for(const StringView& part : parts)
+  std::vector<T> output;
+  output.reserve(static_cast<size_t>(std::count(str.begin(), str.end(), ';')) + 1);
+  size_t pos = 0;
+  while(pos < str.size())
   {
-    output.push_back(convertFromString<int>(part));
+    size_t next_pos = str.find(';', pos);
+    if(next_pos == StringView::npos)
+    {
+      next_pos = str.size();
+    }
+    auto value = tryConvertFromString<T>(str.substr(pos, next_pos - pos));
+    if(!value)
+    {
+      return nonstd::make_unexpected(value.error());
+    }
+    output.push_back(value.value());
+    pos = next_pos + 1;
   }
   return output;
 }
+}  // namespace
+
+template <>
+Expected<std::vector<int>> tryConvertFromString<std::vector<int>>(StringView str)
+{
+  return ParseVector<int>(str);
+}
+
+template <>
+Expected<std::vector<double>> tryConvertFromString<std::vector<double>>(StringView str)
+{
+  return ParseVector<double>(str);
+}
+
+template <>
+Expected<std::vector<bool>> tryConvertFromString<std::vector<bool>>(StringView str)
+{
+  return ParseVector<bool>(str);
+}
+
+template <>
+std::vector<int> convertFromString<std::vector<int>>(StringView str)
+{
+  return ValueOrThrow(tryConvertFromString<std::vector<int>>(str));
+}
 
 template <>
 std::vector<double> convertFromString<std::vector<double>>(StringView str)
 {
-  if(StartWith(str, "json:"))
-  {
-    str.remove_prefix(5);
-    return nlohmann::json::parse(str).get<std::vector<double>>();
-  }
-  auto parts = splitString(str, ';');
-  std::vector<double> output;
-  output.reserve(parts.size());
-  for(const StringView& part : parts)
-  {
-    output.push_back(convertFromString<double>(part));
-  }
-  return output;
+  return ValueOrThrow(tryConvertFromString<std::vector<double>>(str));
 }
 
 template <>
 std::vector<bool> convertFromString<std::vector<bool>>(StringView str)
 {
-  if(StartWith(str, "json:"))
-  {
-    str.remove_prefix(5);
-    return nlohmann::json::parse(str).get<std::vector<bool>>();
-  }
-  auto parts = splitString(str, ';');
-  std::vector<bool> output;
-  output.reserve(parts.size());
-  for(const StringView& part : parts)
-  {
-    output.push_back(convertFromString<bool>(part));
-  }
-  return output;
+  return ValueOrThrow(tryConvertFromString<std::vector<bool>>(str));
 }
 
 template <>
@@ -376,7 +478,7 @@ std::vector<std::string> convertFromString<std::vector<std::string>>(StringView
 }
 
 template <>
-bool convertFromString<bool>(StringView str)
+Expected<bool> tryConvertFromString<bool>(StringView str)
 {
   if(str.size() == 1)
   {
@@ -403,7 +505,13 @@ bool convertFromString<bool>(StringView str)
       return false;
     }
   }
-  throw RuntimeError("convertFromString(): invalid bool conversion");
+  return nonstd::make_unexpected("convertFromString(): invalid bool conversion");
+}
+
+template <>
+bool convertFromString<bool>(StringView str)
+{
+  return ValueOrThrow(tryConvertFromString<bool>(str));
 }
 
 template <>
@@ -634,6 +742,16 @@ Expected<std::string> toJsonString(const Any& value)
   return nonstd::make_unexpected("toJsonString failed");
 }
 
+namespace details
+{
+const std::string& LookupKey(StringView key)
+{
+  thread_local std::string buffer;
+  buffer.assign(key.data(), key.size());
+  return buffer;
+}
+}  // namespace details
+
 bool StartWith(StringView str, StringView prefix)
 {
   if(str.size() < prefix.size())
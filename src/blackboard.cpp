@@ -19,21 +19,27 @@ bool IsPrivateKey(StringView str)
 void Blackboard::enableAutoRemapping(bool remapping)
 {
   autoremapping_ = remapping;
+  invalidateRemappedEntries();
 }
 
-AnyPtrLocked Blackboard::getAnyLocked(const std::string& key)
+AnyPtrLocked Blackboard::getAnyLocked(StringView key)
 {
   if(auto entry = getEntry(key))
   {
-    return AnyPtrLocked(&entry->value, &entry->entry_mutex);
+    AnyPtrLocked locked(&entry->value, &entry->entry_mutex);
+    // the value may be modified through the pointer
+    entry->snapshot.reset();
+    entry->converted_values.clear();
+    return locked;
   }
   return {};
 }
 
-AnyPtrLocked Blackboard::getAnyLocked(const std::string& key) const
+AnyPtrLocked Blackboard::getAnyLocked(StringView key) const
 {
   if(auto entry = getEntry(key))
   {
+    // read-only access: the snapshot and the converted values remain valid
     return AnyPtrLocked(&entry->value, const_cast<std::mutex*>(&entry->entry_mutex));
   }
   return {};
@@ -51,26 +57,46 @@ Any* Blackboard::getAny(const std::string& key)
 }
 
 const std::shared_ptr<Blackboard::Entry>
-Blackboard::getEntry(const std::string& key) const
+Blackboard::getEntry(StringView key) const
 {
   // special syntax: "@" will always refer to the root BB
-  if(StartWith(key, '@'))
-  {
-    return rootBlackboard()->getEntry(key.substr(1, key.size() - 1));
-  }
-
+  const bool root_key = StartWith(key, '@');
+  const uint64_t generation = generation_->load(std::memory_order_acquire);
   {
     const std::shared_lock<std::shared_mutex> storage_lock(storage_mutex_);
-    auto it = storage_.find(key);
-    if(it != storage_.end())
+    if(!root_key)
     {
-      return it->second;
+      auto it = FindKey(storage_, key);
+      if(it != storage_.end())
+      {
+        return it->second;
+      }
+    }
+    // found already in a parent blackboard
+    auto remapped_it = FindKey(remapped_entries_, key);
+    if(remapped_it != remapped_entries_.end() &&
+       remapped_it->second.generation == generation)
+    {
+      return remapped_it->second.entry;
     }
   }
-  // not found. Try autoremapping
+
+  auto entry = root_key ? rootBlackboard()->getEntry(key.substr(1, key.size() - 1)) :
+                          findRemappedEntry(key);
+  // if the generation changed in the meantime, the entry will be searched again
+  if(entry)
+  {
+    const std::unique_lock<std::shared_mutex> storage_lock(storage_mutex_);
+    remapped_entries_[std::string(key)] = { entry, generation };
+  }
+  return entry;
+}
+
+std::shared_ptr<Blackboard::Entry> Blackboard::findRemappedEntry(StringView key) const
+{
   if(auto parent = parent_bb_.lock())
   {
-    auto remap_it = internal_to_external_.find(key);
+    auto remap_it = FindKey(internal_to_external_, key);
     if(remap_it != internal_to_external_.cend())
     {
       auto const& new_key = remap_it->second;
@@ -84,12 +110,17 @@ Blackboard::getEntry(const std::string& key) const
   return {};
 }
 
-std::shared_ptr<Blackboard::Entry> Blackboard::getEntry(const std::string& key)
+void Blackboard::invalidateRemappedEntries()
+{
+  generation_->fetch_add(1, std::memory_order_acq_rel);
+}
+
+std::shared_ptr<Blackboard::Entry> Blackboard::getEntry(StringView key)
 {
   return static_cast<const Blackboard&>(*this).getEntry(key);
 }
 
-const TypeInfo* Blackboard::entryInfo(const std::string& key)
+const TypeInfo* Blackboard::entryInfo(StringView key)
 {
   auto entry = getEntry(key);
   return (!entry) ? nullptr : &(entry->info);
@@ -99,6 +130,7 @@ void Blackboard::addSubtreeRemapping(StringView internal, StringView external)
 {
   internal_to_external_.insert(
       { static_cast<std::string>(internal), static_cast<std::string>(external) });
+  invalidateRemappedEntries();
 }
 
 void Blackboard::debugMessage() const
@@ -159,6 +191,7 @@ void Blackboard::clear()
 {
   const std::unique_lock storage_lock(storage_mutex_);
   storage_.clear();
+  invalidateRemappedEntries();
 }
 
 void Blackboard::createEntry(const std::string& key, const TypeInfo& info)
@@ -267,6 +300,7 @@ void Blackboard::cloneInto(Blackboard& dst) const
     {
       dst.storage_.erase(key);
     }
+    dst.invalidateRemappedEntries();
   }
 }
 
@@ -331,6 +365,7 @@ std::shared_ptr<Blackboard::Entry> Blackboard::createEntryImpl(const std::string
   // even if empty, let's assign to it a default type
   entry->value = Any(info.type());
   storage_.insert({ key, entry });
+  invalidateRemappedEntries();
   return entry;
 }
 
@@ -366,6 +401,8 @@ void ImportBlackboardFromJSON(const nlohmann::json& json, Blackboard& blackboard
       // Lock entry_mutex before writing to prevent data races (BUG-4 fix).
       std::scoped_lock lk(entry->entry_mutex);
       entry->value = res->first;
+      entry->sequence_id++;
+      entry->stamp = std::chrono::steady_clock::now().time_since_epoch();
     }
   }
 }
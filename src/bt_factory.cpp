@@ -18,8 +18,10 @@
 #include "behaviortree_cpp/utils/wildcards.hpp"
 #include "behaviortree_cpp/xml_parsing.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <functional>
+#include <limits>
 
 namespace BT
 {
@@ -127,8 +129,10 @@ BehaviorTreeFactory::BehaviorTreeFactory() : _p(new PImpl)
 
   registerNodeType<ParallelNode>("Parallel");
   registerNodeType<ParallelAllNode>("ParallelAll");
+  registerNodeType<ConcurrentParallelNode>("ConcurrentParallel");
   registerNodeType<ReactiveSequence>("ReactiveSequence");
   registerNodeType<ReactiveFallback>("ReactiveFallback");
+  registerNodeType<UtilitySelectorNode>("UtilitySelector");
   registerNodeType<IfThenElseNode>("IfThenElse");
   registerNodeType<WhileDoElseNode>("WhileDoElse");
   registerNodeType<TryCatchNode>("TryCatch");
@@ -162,6 +166,7 @@ BehaviorTreeFactory::BehaviorTreeFactory() : _p(new PImpl)
   registerNodeType<SwitchNode<4>>("Switch4");
   registerNodeType<SwitchNode<5>>("Switch5");
   registerNodeType<SwitchNode<6>>("Switch6");
+  registerNodeType<DispatchNode>("Dispatch");
 
   registerNodeType<LoopNode<int>>("LoopInt");
   registerNodeType<LoopNode<bool>>("LoopBool");
@@ -632,11 +637,38 @@ void Tree::remapManifestPointers()
 void Tree::initialize()
 {
   wake_up_ = std::make_shared<WakeUpSignal>();
+  tick_deadline_ = std::make_shared<TickDeadline>();
   for(auto& subtree : subtrees)
   {
     for(auto& node : subtree->nodes)
     {
       node->setWakeUpInstance(wake_up_);
+      node->setTickDeadlineInstance(tick_deadline_);
+      node->setClockInstance(clock_);
+    }
+  }
+  indexNodesByUID();
+}
+
+void Tree::indexNodesByUID()
+{
+  uint32_t max_uid = 0;
+  for(const auto& subtree : subtrees)
+  {
+    for(const auto& node : subtree->nodes)
+    {
+      max_uid = std::max(max_uid, node->UID());
+    }
+  }
+  nodes_by_uid_.assign(size_t(max_uid) + 1, nullptr);
+  for(const auto& subtree : subtrees)
+  {
+    for(const auto& node : subtree->nodes)
+    {
+      if(node->UID() != 0)
+      {
+        nodes_by_uid_[node->UID()] = node.get();
+      }
     }
   }
 }
@@ -671,8 +703,7 @@ TreeNode* Tree::rootNode() const
 
 bool Tree::sleep(std::chrono::system_clock::duration timeout)
 {
-  return wake_up_->waitFor(
-      std::chrono::duration_cast<std::chrono::milliseconds>(timeout));
+  return clock_->sleepFor(*wake_up_, std::chrono::duration_cast<Duration>(timeout));
 }
 
 void Tree::emitWakeUpSignal()
@@ -685,6 +716,27 @@ std::shared_ptr<WakeUpSignal> Tree::wakeUpSignal() const
   return wake_up_;
 }
 
+void Tree::setClock(std::shared_ptr<Clock> clock)
+{
+  if(!clock)
+  {
+    throw RuntimeError("Tree::setClock(): the clock can't be null");
+  }
+  clock_ = std::move(clock);
+  for(auto& subtree : subtrees)
+  {
+    for(auto& node : subtree->nodes)
+    {
+      node->setClockInstance(clock_);
+    }
+  }
+}
+
+const std::shared_ptr<Clock>& Tree::clock() const
+{
+  return clock_;
+}
+
 Tree::~Tree()
 {
   haltTree();
@@ -700,6 +752,26 @@ NodeStatus Tree::tickOnce()
   return tickRoot(ONCE_UNLESS_WOKEN_UP, std::chrono::milliseconds(0));
 }
 
+NodeStatus Tree::tickOnceUntil(std::chrono::steady_clock::time_point deadline)
+{
+  if(!wake_up_)
+  {
+    initialize();
+  }
+  tick_deadline_->start(deadline);
+  try
+  {
+    const NodeStatus status = tickRoot(ONCE_UNLESS_WOKEN_UP, std::chrono::milliseconds(0));
+    tick_deadline_->stop();
+    return status;
+  }
+  catch(...)
+  {
+    tick_deadline_->stop();
+    throw;
+  }
+}
+
 NodeStatus Tree::tickWhileRunning(std::chrono::milliseconds sleep_time)
 {
   return tickRoot(WHILE_RUNNING, sleep_time);
@@ -725,12 +797,26 @@ void Tree::applyVisitor(const std::function<void(TreeNode*)>& visitor)
   BT::applyRecursiveVisitor(rootNode(), visitor);
 }
 
-uint16_t Tree::getUID()
+uint32_t Tree::getUID()
 {
+  if(uid_counter_ == std::numeric_limits<uint32_t>::max())
+  {
+    throw RuntimeError("Tree::getUID(): too many nodes");
+  }
   auto uid = ++uid_counter_;
   return uid;
 }
 
+TreeNode* Tree::nodeByUID(uint32_t uid) const
+{
+  return uid < nodes_by_uid_.size() ? nodes_by_uid_[uid] : nullptr;
+}
+
+std::vector<uint64_t> Tree::deadlineOverruns() const
+{
+  return tick_deadline_ ? tick_deadline_->overruns() : std::vector<uint64_t>{};
+}
+
 NodeStatus Tree::tickRoot(TickOption opt, std::chrono::milliseconds sleep_time)
 {
   NodeStatus status = NodeStatus::IDLE;
@@ -752,8 +838,9 @@ NodeStatus Tree::tickRoot(TickOption opt, std::chrono::milliseconds sleep_time)
 
     // Inner loop. The previous tick might have triggered the wake-up
     // in this case, unless TickOption::EXACTLY_ONCE, we tick again
+    // (but not after the deadline of tickOnceUntil())
     while(opt != TickOption::EXACTLY_ONCE && status == NodeStatus::RUNNING &&
-          wake_up_->waitFor(std::chrono::milliseconds(0)))
+          !tick_deadline_->expired() && wake_up_->waitFor(std::chrono::milliseconds(0)))
     {
       status = rootNode()->executeTick();
     }
@@ -762,7 +849,10 @@ NodeStatus Tree::tickRoot(TickOption opt, std::chrono::milliseconds sleep_time)
     {
       rootNode()->resetStatus();
     }
-    if(status == NodeStatus::RUNNING && sleep_time.count() > 0)
+    // a simulated clock advances only while sleeping: tickWhileRunning() sleeps
+    // even if sleep_time is 0, to jump to the next timer instead of spinning
+    const bool simulated_wait = opt == TickOption::WHILE_RUNNING && clock_->isSimulated();
+    if(status == NodeStatus::RUNNING && (sleep_time.count() > 0 || simulated_wait))
     {
       sleep(std::chrono::milliseconds(sleep_time));
     }
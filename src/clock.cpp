@@ -0,0 +1,120 @@
+#include "behaviortree_cpp/utils/clock.h"
+
+#include <algorithm>
+
+namespace BT
+{
+
+namespace
+{
+class RealTimeClock : public Clock
+{
+public:
+  [[nodiscard]] TimePoint now() const override
+  {
+    return std::chrono::high_resolution_clock::now();
+  }
+
+  bool sleepFor(WakeUpSignal& signal, Duration timeout) override
+  {
+    return signal.waitFor(std::chrono::duration_cast<std::chrono::microseconds>(timeout));
+  }
+};
+}  // namespace
+
+void Clock::addScheduler(Scheduler*)
+{}
+
+void Clock::removeScheduler(Scheduler*)
+{}
+
+const std::shared_ptr<Clock>& Clock::realTime()
+{
+  static const std::shared_ptr<Clock> clock = std::make_shared<RealTimeClock>();
+  return clock;
+}
+
+SimulatedClock::SimulatedClock(TimePoint start_time)
+  : time_since_epoch_(start_time.time_since_epoch().count())
+{}
+
+TimePoint SimulatedClock::now() const
+{
+  return TimePoint(Duration(time_since_epoch_.load()));
+}
+
+bool SimulatedClock::sleepFor(WakeUpSignal& signal, Duration timeout)
+{
+  if(timeout.count() <= 0)
+  {
+    // nothing else would advance the time: jump to the next timer, if any
+    const std::scoped_lock lk(schedulers_mutex_);
+    return advanceTo(std::max(now(), nextTime().value_or(now())), &signal);
+  }
+  return advanceTo(now() + timeout, &signal);
+}
+
+void SimulatedClock::addScheduler(Scheduler* scheduler)
+{
+  const std::scoped_lock lk(schedulers_mutex_);
+  schedulers_.push_back(scheduler);
+}
+
+void SimulatedClock::removeScheduler(Scheduler* scheduler)
+{
+  const std::scoped_lock lk(schedulers_mutex_);
+  schedulers_.erase(std::remove(schedulers_.begin(), schedulers_.end(), scheduler),
+                    schedulers_.end());
+}
+
+void SimulatedClock::advance(Duration duration)
+{
+  advanceTo(now() + duration, nullptr);
+}
+
+void SimulatedClock::advanceTo(TimePoint time)
+{
+  advanceTo(time, nullptr);
+}
+
+std::optional<TimePoint> SimulatedClock::nextTime()
+{
+  std::optional<TimePoint> next;
+  // the handlers may add or remove schedulers: don't use iterators
+  for(size_t i = 0; i < schedulers_.size(); i++)
+  {
+    if(auto scheduler_time = schedulers_[i]->nextTime())
+    {
+      next = next ? std::min(*next, *scheduler_time) : *scheduler_time;
+    }
+  }
+  return next;
+}
+
+bool SimulatedClock::advanceTo(TimePoint time, WakeUpSignal* signal)
+{
+  const std::scoped_lock lk(schedulers_mutex_);
+  while(true)
+  {
+    if(signal && signal->waitFor(std::chrono::microseconds(0)))
+    {
+      return true;
+    }
+    // jump to the next timer, if it expires before "time"
+    const TimePoint next = std::min(time, nextTime().value_or(time));
+    if(next > now())
+    {
+      time_since_epoch_.store(next.time_since_epoch().count());
+    }
+    for(size_t i = 0; i < schedulers_.size(); i++)
+    {
+      schedulers_[i]->executeUntil(now());
+    }
+    if(next >= time)
+    {
+      return signal && signal->waitFor(std::chrono::microseconds(0));
+    }
+  }
+}
+
+}  // namespace BT
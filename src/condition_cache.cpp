@@ -0,0 +1,97 @@
+#include "behaviortree_cpp/utils/condition_cache.h"
+
+namespace BT
+{
+
+void ConditionCache::clear()
+{
+  items_.clear();
+}
+
+NodeStatus ConditionCache::executeTick(size_t index, TreeNode& child)
+{
+  if(index >= items_.size())
+  {
+    items_.resize(index + 1);
+  }
+  Item& item = items_[index];
+  if(!item.initialized)
+  {
+    initialize(item, child);
+  }
+  if(!item.cacheable)
+  {
+    return child.executeTick();
+  }
+
+  if(inputsUnchanged(item, child) && item.status != NodeStatus::IDLE)
+  {
+    return item.status;
+  }
+
+  item.status = NodeStatus::IDLE;
+  const NodeStatus status = child.executeTick();
+  const bool completed = (status == NodeStatus::SUCCESS || status == NodeStatus::FAILURE);
+  item.status = (item.complete && completed) ? status : NodeStatus::IDLE;
+  return status;
+}
+
+void ConditionCache::initialize(Item& item, const TreeNode& child)
+{
+  item.initialized = true;
+  const NodeConfig& config = child.config();
+  if(child.type() != NodeType::CONDITION || !config.blackboard ||
+     !config.pre_conditions.empty() || !config.post_conditions.empty() ||
+     !config.output_ports.empty())
+  {
+    return;
+  }
+  for(const auto& [port_name, port_value] : config.input_ports)
+  {
+    // literal values never change
+    if(auto key = TreeNode::getRemappedKey(port_name, port_value))
+    {
+      item.inputs.push_back({ std::string(*key), nullptr, 0 });
+    }
+  }
+  item.cacheable = !item.inputs.empty();
+}
+
+bool ConditionCache::inputsUnchanged(Item& item, const TreeNode& child)
+{
+  const auto& blackboard = child.config().blackboard;
+  bool unchanged = true;
+  item.complete = true;
+  for(auto& input : item.inputs)
+  {
+    // all the inputs are read, to update their sequence_id
+    if(input.changed(blackboard))
+    {
+      unchanged = false;
+    }
+    if(!input.entry)
+    {
+      item.complete = false;
+    }
+  }
+  return unchanged && item.complete;
+}
+
+bool WatchedEntry::changed(const Blackboard::Ptr& blackboard)
+{
+  auto current = blackboard ? blackboard->getEntry(key) : nullptr;
+  uint64_t current_sequence_id = 0;
+  if(current)
+  {
+    const std::scoped_lock lk(current->entry_mutex);
+    current_sequence_id = current->sequence_id;
+  }
+  // comparing the pointers detects an entry removed and created again
+  const bool is_changed =
+      !current || current != entry || current_sequence_id != sequence_id;
+  entry = std::move(current);
+  sequence_id = current_sequence_id;
+  return is_changed;
+}
+
+}  // namespace BT
@@ -39,7 +39,13 @@ void ControlNode::resetChildren()
 {
   for(auto* child : children_nodes_)
   {
-    if(child->status() == NodeStatus::RUNNING)
+    const NodeStatus child_status = child->status();
+    // nothing to do, if the child was not ticked since the last reset
+    if(child_status == NodeStatus::IDLE)
+    {
+      continue;
+    }
+    if(child_status == NodeStatus::RUNNING)
     {
       child->haltNode();
     }
@@ -55,7 +61,12 @@ const std::vector<TreeNode*>& ControlNode::children() const
 void ControlNode::haltChild(size_t i)
 {
   auto* child = children_nodes_[i];
-  if(child->status() == NodeStatus::RUNNING)
+  const NodeStatus child_status = child->status();
+  if(child_status == NodeStatus::IDLE)
+  {
+    return;
+  }
+  if(child_status == NodeStatus::RUNNING)
   {
     child->haltNode();
   }
@@ -0,0 +1,145 @@
+#include "behaviortree_cpp/controls/concurrent_parallel_node.h"
+
+#include "behaviortree_cpp/utils/thread_pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace BT
+{
+
+// State of the children ticked during a single tick of the node.
+// It is shared with the tasks posted to the ThreadPool, that may be
+// executed after the tick is completed, if the child was already
+// ticked by another thread.
+struct ConcurrentParallelNode::Round
+{
+  struct Slot
+  {
+    size_t index = 0;
+    TreeNode* child = nullptr;
+    std::atomic_bool claimed = false;
+    NodeStatus status = NodeStatus::IDLE;
+    std::exception_ptr error;
+  };
+
+  std::unique_ptr<Slot[]> slots;
+  size_t capacity = 0;
+  size_t count = 0;
+
+  std::mutex mutex;
+  std::condition_variable done_cv;
+  size_t remaining = 0;
+
+  // Tick the child of the slot, unless another thread is doing it.
+  void run(size_t slot_index)
+  {
+    auto& slot = slots[slot_index];
+    if(slot.claimed.exchange(true))
+    {
+      return;
+    }
+    try
+    {
+      slot.status = slot.child->executeTick();
+    }
+    catch(...)
+    {
+      slot.error = std::current_exception();
+    }
+    bool last = false;
+    {
+      const std::scoped_lock lk(mutex);
+      last = (--remaining == 0);
+    }
+    if(last)
+    {
+      done_cv.notify_all();
+    }
+  }
+};
+
+ConcurrentParallelNode::ConcurrentParallelNode(const std::string& name,
+                                               const NodeConfig& config)
+  : ParallelNode(name, config), pool_(&ThreadPool::shared())
+{}
+
+ConcurrentParallelNode::~ConcurrentParallelNode() = default;
+
+NodeStatus ConcurrentParallelNode::tick()
+{
+  readThresholds();
+
+  const size_t children_count = children_nodes_.size();
+
+  setStatus(NodeStatus::RUNNING);
+
+  // the previous Round can be reused only if no task refers to it anymore
+  if(!round_ || round_.use_count() > 1 || round_->capacity < children_count)
+  {
+    round_ = std::make_shared<Round>();
+    round_->slots = std::make_unique<Round::Slot[]>(children_count);
+    round_->capacity = children_count;
+  }
+  Round& round = *round_;
+  round.count = 0;
+  for(size_t i = 0; i < children_count; i++)
+  {
+    if(!isCompleted(i))
+    {
+      auto& slot = round.slots[round.count++];
+      slot.index = i;
+      slot.child = children_nodes_[i];
+      slot.claimed = false;
+      slot.status = NodeStatus::IDLE;
+      slot.error = nullptr;
+    }
+  }
+  round.remaining = round.count;
+
+  // The first child is ticked by this thread, the others by the pool.
+  // While waiting, this thread ticks the children that no worker
+  // picked yet: the tick never waits for a busy ThreadPool
+  // (this also makes nesting ConcurrentParallelNodes safe).
+  for(size_t s = 1; s < round.count; s++)
+  {
+    pool_->post([round_ptr = round_, s]() { round_ptr->run(s); });
+  }
+  for(size_t s = 0; s < round.count; s++)
+  {
+    round.run(s);
+  }
+  {
+    std::unique_lock lk(round.mutex);
+    round.done_cv.wait(lk, [&round]() { return round.remaining == 0; });
+  }
+
+  for(size_t s = 0; s < round.count; s++)
+  {
+    if(round.slots[s].error)
+    {
+      std::rethrow_exception(round.slots[s].error);
+    }
+  }
+
+  size_t skipped_count = 0;
+  for(size_t s = 0; s < round.count; s++)
+  {
+    updateCounters(round.slots[s].index, round.slots[s].status, skipped_count);
+  }
+
+  const NodeStatus result = checkThresholds(skipped_count);
+  if(result != NodeStatus::IDLE)
+  {
+    clear();
+    resetChildren();
+    return result;
+  }
+  // Skip if ALL the nodes have been skipped
+  return (skipped_count == children_count) ? NodeStatus::SKIPPED : NodeStatus::RUNNING;
+}
+
+}  // namespace BT
@@ -0,0 +1,142 @@
+#include "behaviortree_cpp/controls/dispatch_node.h"
+
+#include <charconv>
+
+namespace BT
+{
+
+DispatchNode::DispatchNode(const std::string& name, const NodeConfig& config)
+  : ControlNode::ControlNode(name, config)
+{}
+
+void DispatchNode::halt()
+{
+  running_child_ = -1;
+  ControlNode::halt();
+}
+
+bool DispatchNode::toInteger(const std::string& str, int64_t& value) const
+{
+  if(const auto* enums = config().enums.get())
+  {
+    auto it = enums->find(str);
+    if(it != enums->end())
+    {
+      value = it->second;
+      return true;
+    }
+  }
+  const char* end = str.data() + str.size();
+  auto [ptr, ec] = std::from_chars(str.data(), end, value);
+  return ec == std::errc() && ptr == end;
+}
+
+void DispatchNode::parseCases()
+{
+  const auto it = config().input_ports.find(CASES);
+  if(it == config().input_ports.end())
+  {
+    throw RuntimeError("Missing parameter [", CASES, "] in DispatchNode [", name(), "]");
+  }
+  if(isBlackboardPointer(it->second))
+  {
+    throw RuntimeError("The parameter [", CASES, "] of DispatchNode [", name(),
+                       "] must be a literal, not a blackboard entry");
+  }
+
+  string_cases_.clear();
+  integer_cases_.clear();
+  size_t index = 0;
+  for(auto case_str : splitString(it->second, ';'))
+  {
+    // strip leading and following spaces
+    while(!case_str.empty() && case_str.front() == ' ')
+    {
+      case_str.remove_prefix(1);
+    }
+    while(!case_str.empty() && case_str.back() == ' ')
+    {
+      case_str.remove_suffix(1);
+    }
+    if(case_str.empty())
+    {
+      throw RuntimeError("Empty case in DispatchNode [", name(), "]");
+    }
+    std::string case_value(case_str);
+    int64_t integer = 0;
+    if(toInteger(case_value, integer) && !integer_cases_.emplace(integer, index).second)
+    {
+      throw RuntimeError("Duplicated case [", case_value, "] in DispatchNode [", name(),
+                         "]");
+    }
+    if(!string_cases_.emplace(std::move(case_value), index).second)
+    {
+      throw RuntimeError("Duplicated case [", case_str, "] in DispatchNode [", name(),
+                         "]");
+    }
+    index++;
+  }
+
+  if(childrenCount() != string_cases_.size() + 1)
+  {
+    throw LogicError("Wrong number of children in DispatchNode [", name(),
+                     "]; must be (num_cases + default)");
+  }
+  cases_parsed_ = true;
+}
+
+size_t DispatchNode::findCase(const std::string& variable) const
+{
+  if(auto it = string_cases_.find(variable); it != string_cases_.end())
+  {
+    return it->second;
+  }
+  int64_t integer = 0;
+  if(!integer_cases_.empty() && toInteger(variable, integer))
+  {
+    if(auto it = integer_cases_.find(integer); it != integer_cases_.end())
+    {
+      return it->second;
+    }
+  }
+  return string_cases_.size();  // default
+}
+
+NodeStatus DispatchNode::tick()
+{
+  if(!cases_parsed_)
+  {
+    parseCases();
+  }
+
+  // no variable? jump to default
+  std::string variable;
+  const int match_index =
+      getInput("variable", variable) ? int(findCase(variable)) : int(string_cases_.size());
+
+  // if another one was running earlier, halt it
+  if(running_child_ != -1 && running_child_ != match_index)
+  {
+    haltChild(size_t(running_child_));
+  }
+
+  NodeStatus ret = children_nodes_[size_t(match_index)]->executeTick();
+  if(ret == NodeStatus::SKIPPED)
+  {
+    // same as the SwitchNode: don't jump to default
+    running_child_ = -1;
+    return NodeStatus::SKIPPED;
+  }
+  else if(ret == NodeStatus::RUNNING)
+  {
+    running_child_ = match_index;
+  }
+  else
+  {
+    resetChildren();
+    running_child_ = -1;
+  }
+  return ret;
+}
+
+}  // namespace BT
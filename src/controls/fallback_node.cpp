@@ -78,7 +78,14 @@ NodeStatus FallbackNode::tick()
         throw LogicError("[", name(), "]: A children should not return IDLE");
       }
     }  // end switch
-  }    // end while loop
+
+    // the deadline of Tree::tickOnceUntil() was reached:
+    // continue from the next child at the following tick
+    if(current_child_idx_ < children_count && tickDeadlineExpired())
+    {
+      return NodeStatus::RUNNING;
+    }
+  }  // end while loop
 
   // The entire while loop completed. This means that all the children returned FAILURE.
   const bool all_children_skipped = (skipped_count_ == children_count);
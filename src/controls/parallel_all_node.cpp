@@ -39,6 +39,11 @@ NodeStatus ParallelAllNode::tick()
     throw LogicError("Number of children is less than threshold. Can never fail.");
   }
 
+  if(completed_list_.size() != children_count)
+  {
+    completed_list_.assign(children_count, false);
+  }
+
   setStatus(NodeStatus::RUNNING);
 
   // Routing the tree according to the sequence node's logic:
@@ -47,7 +52,7 @@ NodeStatus ParallelAllNode::tick()
     TreeNode* child_node = children_nodes_[index];
 
     // already completed
-    if(completed_list_.count(index) != 0)
+    if(completed_list_[index])
     {
       continue;
     }
@@ -57,12 +62,14 @@ NodeStatus ParallelAllNode::tick()
     switch(child_status)
     {
       case NodeStatus::SUCCESS: {
-        completed_list_.insert(index);
+        completed_list_[index] = true;
+        completed_count_++;
       }
       break;
 
       case NodeStatus::FAILURE: {
-        completed_list_.insert(index);
+        completed_list_[index] = true;
+        completed_count_++;
         failure_count_++;
       }
       break;
@@ -87,14 +94,13 @@ NodeStatus ParallelAllNode::tick()
   {
     return NodeStatus::SKIPPED;
   }
-  if(skipped_count + completed_list_.size() >= children_count)
+  if(skipped_count + completed_count_ >= children_count)
   {
     // DONE
     haltChildren();
-    completed_list_.clear();
     auto const status = (failure_count_ >= failure_threshold_) ? NodeStatus::FAILURE :
                                                                  NodeStatus::SUCCESS;
-    failure_count_ = 0;
+    clear();
     return status;
   }
 
@@ -102,10 +108,19 @@ NodeStatus ParallelAllNode::tick()
   return NodeStatus::RUNNING;
 }
 
-void ParallelAllNode::halt()
+void ParallelAllNode::clear()
 {
-  completed_list_.clear();
+  if(completed_count_ > 0)
+  {
+    std::fill(completed_list_.begin(), completed_list_.end(), false);
+  }
+  completed_count_ = 0;
   failure_count_ = 0;
+}
+
+void ParallelAllNode::halt()
+{
+  clear();
   ControlNode::halt();
 }
 
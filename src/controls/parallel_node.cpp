@@ -37,7 +37,7 @@ ParallelNode::ParallelNode(const std::string& name, const NodeConfig& config)
   , read_parameter_from_ports_(true)
 {}
 
-NodeStatus ParallelNode::tick()
+void ParallelNode::readThresholds()
 {
   if(read_parameter_from_ports_)
   {
@@ -64,6 +64,73 @@ NodeStatus ParallelNode::tick()
     throw LogicError("Number of children is less than threshold. Can never fail.");
   }
 
+  if(completed_list_.size() != children_count)
+  {
+    completed_list_.assign(children_count, false);
+  }
+}
+
+void ParallelNode::updateCounters(size_t index, NodeStatus child_status,
+                                  size_t& skipped_count)
+{
+  switch(child_status)
+  {
+    case NodeStatus::SKIPPED: {
+      skipped_count++;
+    }
+    break;
+
+    case NodeStatus::SUCCESS: {
+      completed_list_[index] = true;
+      success_count_++;
+    }
+    break;
+
+    case NodeStatus::FAILURE: {
+      completed_list_[index] = true;
+      failure_count_++;
+    }
+    break;
+
+    case NodeStatus::RUNNING: {
+      // Still working. Check the next
+    }
+    break;
+
+    case NodeStatus::IDLE: {
+      throw LogicError("[", name(), "]: A children should not return IDLE");
+    }
+  }
+}
+
+NodeStatus ParallelNode::checkThresholds(size_t skipped_count) const
+{
+  const size_t children_count = children_nodes_.size();
+  const size_t required_success_count = successThreshold();
+
+  if(success_count_ >= required_success_count ||
+     (success_threshold_ < 0 &&
+      (success_count_ + skipped_count) >= required_success_count))
+  {
+    return NodeStatus::SUCCESS;
+  }
+
+  // It fails if it is not possible to succeed anymore or if
+  // number of failures are equal to failure_threshold_
+  if(((children_count - failure_count_) < required_success_count) ||
+     (failure_count_ == failureThreshold()))
+  {
+    return NodeStatus::FAILURE;
+  }
+  return NodeStatus::IDLE;
+}
+
+NodeStatus ParallelNode::tick()
+{
+  readThresholds();
+
+  const size_t children_count = children_nodes_.size();
+
   setStatus(NodeStatus::RUNNING);
 
   size_t skipped_count = 0;
@@ -71,60 +138,18 @@ NodeStatus ParallelNode::tick()
   // Routing the tree according to the sequence node's logic:
   for(size_t i = 0; i < children_count; i++)
   {
-    if(completed_list_.count(i) == 0)
+    if(!isCompleted(i))
     {
       TreeNode* child_node = children_nodes_[i];
-      NodeStatus const child_status = child_node->executeTick();
-
-      switch(child_status)
-      {
-        case NodeStatus::SKIPPED: {
-          skipped_count++;
-        }
-        break;
-
-        case NodeStatus::SUCCESS: {
-          completed_list_.insert(i);
-          success_count_++;
-        }
-        break;
-
-        case NodeStatus::FAILURE: {
-          completed_list_.insert(i);
-          failure_count_++;
-        }
-        break;
-
-        case NodeStatus::RUNNING: {
-          // Still working. Check the next
-        }
-        break;
-
-        case NodeStatus::IDLE: {
-          throw LogicError("[", name(), "]: A children should not return IDLE");
-        }
-      }
-    }
-
-    const size_t required_success_count = successThreshold();
-
-    if(success_count_ >= required_success_count ||
-       (success_threshold_ < 0 &&
-        (success_count_ + skipped_count) >= required_success_count))
-    {
-      clear();
-      resetChildren();
-      return NodeStatus::SUCCESS;
+      updateCounters(i, child_node->executeTick(), skipped_count);
     }
 
-    // It fails if it is not possible to succeed anymore or if
-    // number of failures are equal to failure_threshold_
-    if(((children_count - failure_count_) < required_success_count) ||
-       (failure_count_ == failureThreshold()))
+    const NodeStatus result = checkThresholds(skipped_count);
+    if(result != NodeStatus::IDLE)
     {
       clear();
       resetChildren();
-      return NodeStatus::FAILURE;
+      return result;
     }
   }
   // Skip if ALL the nodes have been skipped
@@ -133,7 +158,10 @@ NodeStatus ParallelNode::tick()
 
 void ParallelNode::clear()
 {
-  completed_list_.clear();
+  if(success_count_ + failure_count_ > 0)
+  {
+    std::fill(completed_list_.begin(), completed_list_.end(), false);
+  }
   success_count_ = 0;
   failure_count_ = 0;
 }
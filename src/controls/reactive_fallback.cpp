@@ -22,19 +22,44 @@ void ReactiveFallback::EnableException(bool enable)
   ReactiveFallback::throw_if_multiple_running = enable;
 }
 
+void ReactiveFallback::setIncremental(bool enable)
+{
+  incremental_ = enable;
+  if(!incremental_)
+  {
+    condition_cache_.clear();
+  }
+}
+
 NodeStatus ReactiveFallback::tick()
 {
   bool all_skipped = true;
   if(status() == NodeStatus::IDLE)
   {
     running_child_ = -1;
+    if(read_parameter_from_ports_)
+    {
+      bool incremental = false;
+      if(!getInput(INCREMENTAL, incremental))
+      {
+        throw RuntimeError("[", name(), "]: invalid value of the port [", INCREMENTAL,
+                           "]");
+      }
+      setIncremental(incremental);
+      // a literal value can not change: no need to read it again
+      const auto it = config().input_ports.find(INCREMENTAL);
+      read_parameter_from_ports_ =
+          (it != config().input_ports.end() && isBlackboardPointer(it->second));
+    }
   }
   setStatus(NodeStatus::RUNNING);
 
   for(size_t index = 0; index < childrenCount(); index++)
   {
     TreeNode* current_child_node = children_nodes_[index];
-    const NodeStatus child_status = current_child_node->executeTick();
+    const NodeStatus child_status =
+        incremental_ ? condition_cache_.executeTick(index, *current_child_node) :
+                       current_child_node->executeTick();
 
     // switch to RUNNING state as soon as you find an active child
     all_skipped &= (child_status == NodeStatus::SKIPPED);
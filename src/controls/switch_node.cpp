@@ -19,80 +19,67 @@
 namespace BT::details
 {
 
-bool CheckStringEquality(const std::string& v1, const std::string& v2,
-                         const ScriptingEnumsRegistry* enums)
+namespace
 {
-  // compare strings first
-  if(v1 == v2)
+// A number, or the value of an enum
+bool ToReal(const std::string& str, const ScriptingEnumsRegistry* enums, double& result)
+{
+  if(enums)
   {
-    return true;
-  }
-  // compare as integers next
-  auto ToInt = [enums](const std::string& str, auto& result) -> bool {
-    if(enums)
+    auto it = enums->find(str);
+    if(it != enums->end())
     {
-      auto it = enums->find(str);
-      if(it != enums->end())
-      {
-        result = it->second;
-        return true;
-      }
+      result = it->second;
+      return true;
     }
+  }
 #if __cpp_lib_to_chars >= 201611L
-    const char* end = str.data() + str.size();
-    auto [ptr, ec] = std::from_chars(str.data(), end, result);
-    return ec == std::errc() && ptr == end;
+  const char* end = str.data() + str.size();
+  auto [ptr, ec] = std::from_chars(str.data(), end, result);
+  return ec == std::errc() && ptr == end;
 #else
-    try
-    {
-      std::size_t pos = 0;
-      result = std::stoi(str, &pos);
-      return pos == str.size();
-    }
-    catch(...)
-    {
-      return false;
-    }
+  try
+  {
+    std::size_t pos = 0;
+    result = std::stod(str, &pos);
+    return pos == str.size();
+  }
+  catch(...)
+  {
+    return false;
+  }
 #endif
-  };
-  int v1_int = 0;
-  int v2_int = 0;
-  if(ToInt(v1, v1_int) && ToInt(v2, v2_int) && v1_int == v2_int)
+}
+}  // namespace
+
+SwitchCase ParseSwitchCase(std::string str, const ScriptingEnumsRegistry* enums)
+{
+  SwitchCase parsed;
+  parsed.is_number = ToReal(str, enums, parsed.number);
+  parsed.str = std::move(str);
+  return parsed;
+}
+
+bool CheckCaseEquality(const SwitchCase& v1, const SwitchCase& v2)
+{
+  // compare strings first, then as real numbers.
+  // Two integers (or enums) that are equal are also equal as real numbers
+  if(v1.str == v2.str)
   {
     return true;
   }
-  // compare as real numbers next
-  auto ToReal = [enums](const std::string& str, auto& result) -> bool {
-    if(enums)
-    {
-      auto it = enums->find(str);
-      if(it != enums->end())
-      {
-        result = it->second;
-        return true;
-      }
-    }
-#if __cpp_lib_to_chars >= 201611L
-    const char* end = str.data() + str.size();
-    auto [ptr, ec] = std::from_chars(str.data(), end, result);
-    return ec == std::errc() && ptr == end;
-#else
-    try
-    {
-      std::size_t pos = 0;
-      result = std::stod(str, &pos);
-      return pos == str.size();
-    }
-    catch(...)
-    {
-      return false;
-    }
-#endif
-  };
-  double v1_real = 0;
-  double v2_real = 0;
   constexpr auto eps = double(std::numeric_limits<float>::epsilon());
-  return ToReal(v1, v1_real) && ToReal(v2, v2_real) && std::abs(v1_real - v2_real) <= eps;
+  return v1.is_number && v2.is_number && std::abs(v1.number - v2.number) <= eps;
+}
+
+bool CheckStringEquality(const std::string& v1, const std::string& v2,
+                         const ScriptingEnumsRegistry* enums)
+{
+  if(v1 == v2)
+  {
+    return true;
+  }
+  return CheckCaseEquality(ParseSwitchCase(v1, enums), ParseSwitchCase(v2, enums));
 }
 
 }  // namespace BT::details
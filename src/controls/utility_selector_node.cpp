@@ -0,0 +1,309 @@
+#include "behaviortree_cpp/controls/utility_selector_node.h"
+#include "behaviortree_cpp/scripting/any_types.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace BT
+{
+
+UtilitySelectorNode::UtilitySelectorNode(const std::string& name,
+                                         const NodeConfig& config)
+  : ControlNode::ControlNode(name, config)
+{
+  parseScores();
+}
+
+void UtilitySelectorNode::halt()
+{
+  running_child_ = -1;
+  ControlNode::halt();
+}
+
+std::vector<double> UtilitySelectorNode::scores() const
+{
+  std::vector<double> values;
+  values.reserve(scores_.size());
+  for(const auto& score : scores_)
+  {
+    values.push_back(score.value);
+  }
+  return values;
+}
+
+void UtilitySelectorNode::parseScores()
+{
+  const auto it = config().input_ports.find(SCORES);
+  if(it == config().input_ports.end())
+  {
+    throw RuntimeError("Missing parameter [", SCORES, "] in UtilitySelector [", name(),
+                       "]");
+  }
+  // the scores are computed elsewhere
+  if(auto key = getRemappedKey(SCORES, it->second))
+  {
+    scores_entry_.key = std::string(key.value());
+    return;
+  }
+
+  const std::string& source = it->second;
+  const auto tokens = Scripting::tokenize(source);
+  size_t start = 0;
+  std::vector<std::string> names;
+  for(const auto& token : tokens)
+  {
+    switch(token.type)
+    {
+      case Scripting::TokenType::Identifier:
+        if(std::find(names.begin(), names.end(), token.text) == names.end())
+        {
+          names.emplace_back(token.text);
+        }
+        continue;
+      case Scripting::TokenType::ColonEqual:
+      case Scripting::TokenType::Equal:
+      case Scripting::TokenType::PlusEqual:
+      case Scripting::TokenType::MinusEqual:
+      case Scripting::TokenType::StarEqual:
+      case Scripting::TokenType::SlashEqual:
+        throw RuntimeError("The scores of UtilitySelector [", name(),
+                           "] can not modify the blackboard: ", source);
+      case Scripting::TokenType::Semicolon:
+      case Scripting::TokenType::EndOfInput:
+        break;
+      default:
+        continue;
+    }
+
+    // end of an expression
+    const std::string expression = source.substr(start, token.pos - start);
+    start = token.pos + 1;
+    if(expression.find_first_not_of(" \t\n\r") == std::string::npos)
+    {
+      // allow a trailing ';'
+      if(token.type == Scripting::TokenType::EndOfInput && !scores_.empty())
+      {
+        break;
+      }
+      throw RuntimeError("Empty score in UtilitySelector [", name(), "]");
+    }
+    auto function = ParseScript(expression);
+    if(!function)
+    {
+      throw RuntimeError("Invalid score [", expression, "] in UtilitySelector [",
+                         name(), "]: ", function.error());
+    }
+    Score score;
+    score.function = std::move(function.value());
+    score.names = std::move(names);
+    scores_.push_back(std::move(score));
+    names.clear();
+  }
+}
+
+void UtilitySelectorNode::findInputs()
+{
+  if(!scores_entry_.key.empty())
+  {
+    scores_.resize(childrenCount());
+  }
+  if(childrenCount() != scores_.size())
+  {
+    throw LogicError("Wrong number of children in UtilitySelector [", name(),
+                     "]; must be equal to the number of scores");
+  }
+
+  inputs_.clear();
+  std::unordered_map<std::string, size_t> input_index;
+  const auto* enums = config().enums.get();
+  for(size_t i = 0; i < scores_.size(); i++)
+  {
+    for(const auto& name : scores_[i].names)
+    {
+      // the value of an enum never changes
+      if(enums && enums->count(name) != 0)
+      {
+        continue;
+      }
+      auto [it, inserted] = input_index.emplace(name, inputs_.size());
+      if(inserted)
+      {
+        inputs_.emplace_back().watched.key = name;
+      }
+      inputs_[it->second].scores.push_back(i);
+    }
+    scores_[i].valid = false;
+  }
+  order_.reserve(scores_.size());
+  inputs_found_ = true;
+}
+
+void UtilitySelectorNode::updateScores()
+{
+  if(!scores_entry_.key.empty())
+  {
+    readScoresEntry();
+    return;
+  }
+  const auto& blackboard = config().blackboard;
+  for(auto& input : inputs_)
+  {
+    if(input.watched.changed(blackboard))
+    {
+      for(size_t index : input.scores)
+      {
+        scores_[index].valid = false;
+      }
+    }
+  }
+
+  Ast::Environment env = { blackboard, config().enums };
+  for(auto& score : scores_)
+  {
+    if(!score.valid)
+    {
+      score.value = score.function(env).cast<double>();
+      score.valid = true;
+    }
+  }
+}
+
+void UtilitySelectorNode::readScoresEntry()
+{
+  if(!scores_entry_.changed(config().blackboard))
+  {
+    return;
+  }
+  if(!scores_entry_.entry)
+  {
+    throw RuntimeError("[", name(), "]: the blackboard entry [", scores_entry_.key,
+                       "] of the port [", SCORES, "] doesn't exist");
+  }
+
+  // if the value is not valid, forget the entry to read it again at the next tick
+  std::vector<double> values;
+  if(auto res = getInput(SCORES, values); !res)
+  {
+    scores_entry_.entry.reset();
+    throw RuntimeError("[", name(), "]: invalid value of the port [", SCORES,
+                       "]: ", res.error());
+  }
+  if(values.size() != scores_.size())
+  {
+    scores_entry_.entry.reset();
+    throw RuntimeError("[", name(), "]: the port [", SCORES, "] contains ",
+                       std::to_string(values.size()), " scores, but there are ",
+                       std::to_string(scores_.size()), " children");
+  }
+  for(size_t i = 0; i < values.size(); i++)
+  {
+    scores_[i].value = values[i];
+  }
+}
+
+size_t UtilitySelectorNode::bestChild() const
+{
+  size_t best = 0;
+  for(size_t i = 1; i < scores_.size(); i++)
+  {
+    if(scores_[i].value > scores_[best].value)
+    {
+      best = i;
+    }
+  }
+  if(running_child_ != -1 && size_t(running_child_) != best &&
+     scores_[best].value <= scores_[size_t(running_child_)].value + hysteresis_)
+  {
+    return size_t(running_child_);
+  }
+  return best;
+}
+
+NodeStatus UtilitySelectorNode::tick()
+{
+  if(!inputs_found_)
+  {
+    findInputs();
+  }
+  if(status() == NodeStatus::IDLE)
+  {
+    running_child_ = -1;
+    if(!getInput(HYSTERESIS, hysteresis_))
+    {
+      throw RuntimeError("[", name(), "]: invalid value of the port [", HYSTERESIS, "]");
+    }
+  }
+  setStatus(NodeStatus::RUNNING);
+
+  updateScores();
+
+  size_t index = bestChild();
+  size_t next = 0;
+  size_t skipped_count = 0;
+  order_.clear();
+  while(true)
+  {
+    const NodeStatus child_status = children_nodes_[index]->executeTick();
+    switch(child_status)
+    {
+      case NodeStatus::RUNNING: {
+        // halt the child that was running earlier and the ones that failed
+        for(size_t i = 0; i < childrenCount(); i++)
+        {
+          if(i != index)
+          {
+            haltChild(i);
+          }
+        }
+        running_child_ = static_cast<int>(index);
+        return NodeStatus::RUNNING;
+      }
+
+      case NodeStatus::SUCCESS: {
+        resetChildren();
+        running_child_ = -1;
+        return NodeStatus::SUCCESS;
+      }
+
+      case NodeStatus::SKIPPED:
+        skipped_count++;
+        [[fallthrough]];
+
+      case NodeStatus::FAILURE: {
+        if(order_.empty())
+        {
+          // the other children are sorted only when needed
+          for(size_t i = 0; i < scores_.size(); i++)
+          {
+            if(i != index)
+            {
+              order_.push_back(i);
+            }
+          }
+          std::stable_sort(order_.begin(), order_.end(), [this](size_t a, size_t b) {
+            return scores_[a].value > scores_[b].value;
+          });
+        }
+      }
+      break;
+
+      case NodeStatus::IDLE: {
+        throw LogicError("[", name(), "]: A children should not return IDLE");
+      }
+    }  // end switch
+
+    if(next >= order_.size())
+    {
+      break;
+    }
+    index = order_[next++];
+  }
+
+  resetChildren();
+  running_child_ = -1;
+
+  // Skip if ALL the nodes have been skipped
+  return (skipped_count == childrenCount()) ? NodeStatus::SKIPPED : NodeStatus::FAILURE;
+}
+
+}  // namespace BT
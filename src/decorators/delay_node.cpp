@@ -42,6 +42,7 @@ NodeStatus DelayNode::tick()
     delay_started_ = true;
     setStatus(NodeStatus::RUNNING);
 
+    timer_.setClock(clock());
     timer_id_ = timer_.add(std::chrono::milliseconds(msec_), [this](bool aborted) {
       const std::unique_lock<std::mutex> lk(delay_mutex_);
       delay_complete_ = (!aborted);
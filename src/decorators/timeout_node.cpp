@@ -33,6 +33,7 @@ NodeStatus TimeoutNode::tick()
 
     if(msec_ > 0)
     {
+      timer_.setClock(clock());
       timer_id_ = timer_.add(std::chrono::milliseconds(msec_), [this](bool aborted) {
         // Return immediately if the timer was aborted.
         // This function could be invoked during destruction of this object and
@@ -2,11 +2,13 @@
 
 #include "behaviortree_cpp/xml_parsing.h"
 
+#include <algorithm>
 #include <array>
 #include <condition_variable>
 #include <cstring>
 #include <deque>
 #include <fstream>
+#include <limits>
 #include <mutex>
 #include <thread>
 
@@ -30,6 +32,8 @@ struct FileLogger2::Pimpl
   std::mutex file_mutex;  // Protects file_stream access from multiple threads
 
   Duration first_timestamp = {};
+  // bytes used to serialize the node_uid of a Transition
+  size_t uid_size = 2;
 
   std::deque<FileLogger2::Transition> transitions_queue;
   std::condition_variable queue_cv;
@@ -61,7 +65,17 @@ FileLogger2::FileLogger2(const BT::Tree& tree, std::filesystem::path const& file
 
   _p->file_stream << "BTCPP4-FileLogger2";
 
-  const uint8_t protocol = 1;
+  uint32_t max_uid = 0;
+  for(const auto& subtree : tree.subtrees)
+  {
+    for(const auto& node : subtree->nodes)
+    {
+      max_uid = std::max(max_uid, node->UID());
+    }
+  }
+  // the original format, with 16 bits UIDs, is used whenever possible
+  const uint8_t protocol = (max_uid > std::numeric_limits<uint16_t>::max()) ? 2 : 1;
+  _p->uid_size = (protocol == 1) ? 2 : 4;
 
   _p->file_stream << protocol;
 
@@ -75,7 +89,7 @@ FileLogger2::FileLogger2(const BT::Tree& tree, std::filesystem::path const& file
   // write the XML definition
   _p->file_stream.write(xml.data(), static_cast<std::streamsize>(xml.size()));
 
-  _p->first_timestamp = std::chrono::system_clock::now().time_since_epoch();
+  _p->first_timestamp = tree.clock()->now().time_since_epoch();
 
   // save the first timestamp in the next 8 bytes (microseconds)
   const int64_t timestamp_usec = ToUsec(_p->first_timestamp);
@@ -151,12 +165,22 @@ void FileLogger2::writerLoop()
       while(!transitions.empty())
       {
         const auto trans = transitions.front();
-        std::array<char, 9> write_buffer{};
+        const size_t uid_size = _p->uid_size;
+        std::array<char, 11> write_buffer{};
         std::memcpy(write_buffer.data(), &trans.timestamp_usec, 6);
-        std::memcpy(write_buffer.data() + 6, &trans.node_uid, 2);
-        std::memcpy(write_buffer.data() + 8, &trans.status, 1);
-
-        _p->file_stream.write(write_buffer.data(), 9);
+        if(uid_size == 2)
+        {
+          const auto node_uid = static_cast<uint16_t>(trans.node_uid);
+          std::memcpy(write_buffer.data() + 6, &node_uid, 2);
+        }
+        else
+        {
+          std::memcpy(write_buffer.data() + 6, &trans.node_uid, 4);
+        }
+        std::memcpy(write_buffer.data() + 6 + uid_size, &trans.status, 1);
+
+        _p->file_stream.write(write_buffer.data(),
+                              static_cast<std::streamsize>(7 + uid_size));
         transitions.pop_front();
       }
       _p->file_stream.flush();
@@ -2,10 +2,80 @@
 
 #include "behaviortree_cpp/control_node.h"
 #include "behaviortree_cpp/decorator_node.h"
+#include "behaviortree_cpp/utils/callback_gate.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
 
 namespace BT
 {
-TreeObserver::TreeObserver(const BT::Tree& tree) : StatusChangeLogger(tree.rootNode())
+
+namespace
+{
+struct NodeCounters
+{
+  bool observed = false;
+  std::atomic<NodeStatus> last_result = NodeStatus::IDLE;
+  std::atomic<NodeStatus> current_status = NodeStatus::IDLE;
+  std::atomic<unsigned> transitions_count = 0;
+  std::atomic<unsigned> success_count = 0;
+  std::atomic<unsigned> failure_count = 0;
+  std::atomic<unsigned> skip_count = 0;
+  std::atomic<Duration::rep> last_timestamp = 0;
+  // allocated at the first tick() measured: most nodes of a large tree
+  // might never be executed
+  std::atomic<details::DurationHistogram*> tick_durations = nullptr;
+
+  NodeCounters() = default;
+  NodeCounters(const NodeCounters&) = delete;
+  NodeCounters& operator=(const NodeCounters&) = delete;
+
+  ~NodeCounters()
+  {
+    delete tick_durations.load(std::memory_order_acquire);
+  }
+
+  void recordTickDuration(uint64_t duration)
+  {
+    auto* histogram = tick_durations.load(std::memory_order_acquire);
+    if(histogram == nullptr)
+    {
+      auto new_histogram = std::make_unique<details::DurationHistogram>();
+      // if another thread was faster, use its histogram
+      if(tick_durations.compare_exchange_strong(histogram, new_histogram.get(),
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire))
+      {
+        histogram = new_histogram.release();
+      }
+    }
+    histogram->record(duration);
+  }
+};
+
+}  // namespace
+
+struct TreeObserver::PImpl
+{
+  // dense array, indexed by TreeNode::UID()
+  std::vector<NodeCounters> counters;
+
+  // the callbacks are removed from the nodes when these are destroyed
+  std::vector<TreeNode::TickMonitorSubscriber> monitor_subscribers;
+  details::CallbackGate::Ptr monitor_gate = std::make_shared<details::CallbackGate>();
+
+  const NodeCounters& at(uint32_t uid) const
+  {
+    if(uid >= counters.size() || !counters[uid].observed)
+    {
+      throw RuntimeError("TreeObserver: Invalid UID");
+    }
+    return counters[uid];
+  }
+};
+
+TreeObserver::TreeObserver(const BT::Tree& tree) : _p(std::make_unique<PImpl>())
 {
   std::function<void(const TreeNode&)> recursiveStep;
 
@@ -37,51 +107,104 @@ TreeObserver::TreeObserver(const BT::Tree& tree) : StatusChangeLogger(tree.rootN
     recursiveStep(*subtree->nodes.front());
   }
 
+  uint32_t max_uid = 0;
   for(const auto& [path, uid] : _path_to_uid)
   {
-    _statistics[uid] = {};
     _uid_to_path[uid] = path;
+    max_uid = std::max(max_uid, uid);
+  }
+
+  // UIDs are assigned sequentially by the Tree: this array has no holes
+  _p->counters = std::vector<NodeCounters>(size_t(max_uid) + 1);
+  for(const auto& [uid, path] : _uid_to_path)
+  {
+    _p->counters[uid].observed = true;
+  }
+
+  auto monitorCallback = [counters = _p->counters.data(), max_uid,
+                          gate = _p->monitor_gate](TreeNode& node, NodeStatus,
+                                                   std::chrono::microseconds duration) {
+    if(node.UID() > max_uid || !gate->tryStart())
+    {
+      return;
+    }
+    const details::CallbackGate::Guard callback_guard(gate);
+    counters[node.UID()].recordTickDuration(uint64_t(std::max<int64_t>(0, duration.count())));
+  };
+
+  for(const auto& subtree : tree.subtrees)
+  {
+    for(const auto& node : subtree->nodes)
+    {
+      _p->monitor_subscribers.push_back(node->subscribeToTickMonitor(monitorCallback));
+    }
   }
+
+  // subscribe only when the counters are ready
+  subscribeToTreeChanges(tree.rootNode());
 }
 
 TreeObserver::~TreeObserver()
 {
-  // Stop status callbacks before the statistics map is destroyed.
+  // Stop status callbacks before the statistics are destroyed.
   unsubscribeFromTreeChanges();
+  // The nodes might still be executing a copy of the subscribers
+  _p->monitor_gate->closeAndDrain();
 }
 
 void TreeObserver::callback(Duration timestamp, const TreeNode& node,
                             NodeStatus /*prev_status*/, NodeStatus status)
 {
-  auto& statistics = _statistics[node.UID()];
-  statistics.current_status = status;
-  statistics.last_timestamp = timestamp;
+  if(node.UID() >= _p->counters.size())
+  {
+    return;
+  }
+  auto& counters = _p->counters[node.UID()];
+  counters.current_status.store(status, std::memory_order_relaxed);
+  counters.last_timestamp.store(timestamp.count(), std::memory_order_relaxed);
 
   if(status == NodeStatus::IDLE)
   {
     return;
   }
 
-  statistics.transitions_count++;
+  counters.transitions_count.fetch_add(1, std::memory_order_relaxed);
 
   if(status == NodeStatus::SUCCESS)
   {
-    statistics.last_result = status;
-    statistics.success_count++;
+    counters.last_result.store(status, std::memory_order_relaxed);
+    counters.success_count.fetch_add(1, std::memory_order_relaxed);
   }
   else if(status == NodeStatus::FAILURE)
   {
-    statistics.last_result = status;
-    statistics.failure_count++;
+    counters.last_result.store(status, std::memory_order_relaxed);
+    counters.failure_count.fetch_add(1, std::memory_order_relaxed);
   }
   else if(status == NodeStatus::SKIPPED)
   {
-    statistics.skip_count++;
+    counters.skip_count.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void TreeObserver::resetStatistics()
+{
+  for(auto& counters : _p->counters)
+  {
+    counters.last_result.store(NodeStatus::IDLE, std::memory_order_relaxed);
+    counters.current_status.store(NodeStatus::IDLE, std::memory_order_relaxed);
+    counters.transitions_count.store(0, std::memory_order_relaxed);
+    counters.success_count.store(0, std::memory_order_relaxed);
+    counters.failure_count.store(0, std::memory_order_relaxed);
+    counters.skip_count.store(0, std::memory_order_relaxed);
+    counters.last_timestamp.store(0, std::memory_order_relaxed);
+    if(auto* histogram = counters.tick_durations.load(std::memory_order_acquire))
+    {
+      histogram->reset();
+    }
   }
 }
 
-const TreeObserver::NodeStatistics&
-TreeObserver::getStatistics(const std::string& path) const
+TreeObserver::NodeStatistics TreeObserver::getStatistics(const std::string& path) const
 {
   auto it = _path_to_uid.find(path);
   if(it == _path_to_uid.end())
@@ -91,28 +214,64 @@ TreeObserver::getStatistics(const std::string& path) const
   return getStatistics(it->second);
 }
 
-const TreeObserver::NodeStatistics& TreeObserver::getStatistics(uint16_t uid) const
+TreeObserver::NodeStatistics TreeObserver::getStatistics(uint32_t uid) const
+{
+  const auto& counters = _p->at(uid);
+  NodeStatistics stats;
+  stats.last_result = counters.last_result.load(std::memory_order_relaxed);
+  stats.current_status = counters.current_status.load(std::memory_order_relaxed);
+  stats.transitions_count = counters.transitions_count.load(std::memory_order_relaxed);
+  stats.success_count = counters.success_count.load(std::memory_order_relaxed);
+  stats.failure_count = counters.failure_count.load(std::memory_order_relaxed);
+  stats.skip_count = counters.skip_count.load(std::memory_order_relaxed);
+  stats.last_timestamp = Duration(counters.last_timestamp.load(std::memory_order_relaxed));
+  return stats;
+}
+
+std::unordered_map<uint32_t, TreeObserver::NodeStatistics> TreeObserver::statistics() const
+{
+  std::unordered_map<uint32_t, NodeStatistics> all_stats;
+  for(const auto& [uid, path] : _uid_to_path)
+  {
+    all_stats[uid] = getStatistics(uid);
+  }
+  return all_stats;
+}
+
+TreeObserver::TickDurationStatistics
+TreeObserver::getTickDurations(const std::string& path) const
 {
-  auto it = _statistics.find(uid);
-  if(it == _statistics.end())
+  auto it = _path_to_uid.find(path);
+  if(it == _path_to_uid.end())
   {
-    throw RuntimeError("TreeObserver::getStatistics: Invalid UID");
+    throw RuntimeError("TreeObserver::getTickDurations: Invalid pattern");
   }
-  return it->second;
+  return getTickDurations(it->second);
+}
+
+TreeObserver::TickDurationStatistics TreeObserver::getTickDurations(uint32_t uid) const
+{
+  const auto* histogram = _p->at(uid).tick_durations.load(std::memory_order_acquire);
+  return histogram ? histogram->snapshot() : TickDurationStatistics{};
 }
 
-const std::unordered_map<uint16_t, TreeObserver::NodeStatistics>&
-TreeObserver::statistics() const
+std::unordered_map<uint32_t, TreeObserver::TickDurationStatistics>
+TreeObserver::tickDurations() const
 {
-  return _statistics;
+  std::unordered_map<uint32_t, TickDurationStatistics> all_durations;
+  for(const auto& [uid, path] : _uid_to_path)
+  {
+    all_durations[uid] = getTickDurations(uid);
+  }
+  return all_durations;
 }
 
-const std::unordered_map<std::string, uint16_t>& TreeObserver::pathToUID() const
+const std::unordered_map<std::string, uint32_t>& TreeObserver::pathToUID() const
 {
   return _path_to_uid;
 }
 
-const std::map<uint16_t, std::string>& TreeObserver::uidToPath() const
+const std::map<uint32_t, std::string>& TreeObserver::uidToPath() const
 {
   return _uid_to_path;
 }
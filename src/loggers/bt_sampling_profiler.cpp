@@ -0,0 +1,302 @@
+#include "behaviortree_cpp/loggers/bt_sampling_profiler.h"
+
+#include "behaviortree_cpp/contrib/json.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <thread>
+
+namespace BT
+{
+
+namespace
+{
+std::string frameName(const TreeNode& node)
+{
+  std::string frame = (node.name() == node.registrationName()) ?
+                          node.registrationName() :
+                          node.registrationName() + "::" + node.name();
+  // these characters have a special meaning in the folded stacks format
+  std::replace(frame.begin(), frame.end(), ';', ':');
+  std::replace(frame.begin(), frame.end(), '\n', ' ');
+  return frame;
+}
+}  // namespace
+
+struct SamplingProfiler::PImpl
+{
+  using Clock = std::chrono::steady_clock;
+
+  // nodes in depth-first order: the parent always precedes its children
+  std::vector<const TreeNode*> nodes;
+  std::vector<int> parents;
+  std::vector<std::string> folded_stacks;
+
+  mutable std::mutex data_mutex;
+  Clock::time_point start_time = Clock::now();
+  uint64_t samples_count = 0;
+  int64_t last_sample_usec = 0;
+  std::vector<uint64_t> leaf_samples;
+  std::vector<char> running;
+  std::vector<char> has_running_child;
+  // timestamp of the first sample where the node was RUNNING, -1 if it is not
+  std::vector<int64_t> running_since;
+
+  struct TraceEvent
+  {
+    size_t index;
+    int64_t start_usec;
+    int64_t duration_usec;
+  };
+  // ring buffer: when it is full, next_event is the oldest one
+  std::vector<TraceEvent> events;
+  size_t max_events = 0;
+  size_t next_event = 0;
+  uint64_t dropped_events = 0;
+
+  void addEvent(const TraceEvent& event)
+  {
+    if(max_events == 0)
+    {
+      dropped_events++;
+    }
+    else if(events.size() < max_events)
+    {
+      events.push_back(event);
+    }
+    else
+    {
+      events[next_event] = event;
+      next_event = (next_event + 1) % max_events;
+      dropped_events++;
+    }
+  }
+
+  std::mutex thread_mutex;
+  std::condition_variable thread_cv;
+  bool stop_requested = false;
+  std::thread thread;
+};
+
+SamplingProfiler::SamplingProfiler(const Tree& tree,
+                                   std::chrono::microseconds sampling_period,
+                                   size_t max_trace_events)
+  : _p(std::make_unique<PImpl>())
+{
+  _p->max_events = max_trace_events;
+  std::function<void(const TreeNode*, int)> recursiveStep;
+  recursiveStep = [&](const TreeNode* node, int parent) {
+    const int index = int(_p->nodes.size());
+    _p->nodes.push_back(node);
+    _p->parents.push_back(parent);
+    _p->folded_stacks.push_back(
+        parent < 0 ? frameName(*node) :
+                     _p->folded_stacks[size_t(parent)] + ";" + frameName(*node));
+
+    if(auto control = dynamic_cast<const ControlNode*>(node))
+    {
+      for(const auto& child : control->children())
+      {
+        recursiveStep(child, index);
+      }
+    }
+    else if(auto decorator = dynamic_cast<const DecoratorNode*>(node))
+    {
+      if(decorator->child() != nullptr)
+      {
+        recursiveStep(decorator->child(), index);
+      }
+    }
+  };
+  if(auto root = tree.rootNode())
+  {
+    recursiveStep(root, -1);
+  }
+
+  const size_t count = _p->nodes.size();
+  _p->leaf_samples.resize(count, 0);
+  _p->running.resize(count, 0);
+  _p->has_running_child.resize(count, 0);
+  _p->running_since.resize(count, -1);
+
+  if(sampling_period.count() > 0)
+  {
+    _p->thread = std::thread(&SamplingProfiler::samplingLoop, this, sampling_period);
+  }
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+  stop();
+}
+
+void SamplingProfiler::stop()
+{
+  {
+    const std::scoped_lock lk(_p->thread_mutex);
+    _p->stop_requested = true;
+  }
+  _p->thread_cv.notify_all();
+  if(_p->thread.joinable())
+  {
+    _p->thread.join();
+  }
+}
+
+void SamplingProfiler::samplingLoop(std::chrono::microseconds sampling_period)
+{
+  auto next_sample = PImpl::Clock::now() + sampling_period;
+  std::unique_lock lk(_p->thread_mutex);
+  while(!_p->thread_cv.wait_until(lk, next_sample, [this] { return _p->stop_requested; }))
+  {
+    lk.unlock();
+    sample();
+    lk.lock();
+    // skip the samples we missed, rather than bursting to catch up
+    const auto now = PImpl::Clock::now();
+    next_sample += sampling_period;
+    if(next_sample < now)
+    {
+      next_sample = now + sampling_period;
+    }
+  }
+}
+
+void SamplingProfiler::sample()
+{
+  const std::scoped_lock lk(_p->data_mutex);
+  const auto now_usec = std::chrono::duration_cast<std::chrono::microseconds>(
+                            PImpl::Clock::now() - _p->start_time)
+                            .count();
+  const size_t count = _p->nodes.size();
+
+  for(size_t i = 0; i < count; i++)
+  {
+    _p->running[i] = (_p->nodes[i]->status() == NodeStatus::RUNNING) ? 1 : 0;
+    _p->has_running_child[i] = 0;
+  }
+  for(size_t i = 0; i < count; i++)
+  {
+    const int parent = _p->parents[i];
+    if(_p->running[i] != 0 && parent >= 0)
+    {
+      _p->has_running_child[size_t(parent)] = 1;
+    }
+  }
+
+  for(size_t i = 0; i < count; i++)
+  {
+    auto& since = _p->running_since[i];
+    if(_p->running[i] != 0)
+    {
+      if(_p->has_running_child[i] == 0)
+      {
+        _p->leaf_samples[i]++;
+      }
+      if(since < 0)
+      {
+        since = now_usec;
+      }
+    }
+    else if(since >= 0)
+    {
+      _p->addEvent({ i, since, now_usec - since });
+      since = -1;
+    }
+  }
+  _p->samples_count++;
+  _p->last_sample_usec = now_usec;
+}
+
+void SamplingProfiler::reset()
+{
+  const std::scoped_lock lk(_p->data_mutex);
+  _p->start_time = PImpl::Clock::now();
+  _p->samples_count = 0;
+  _p->last_sample_usec = 0;
+  _p->events.clear();
+  _p->next_event = 0;
+  _p->dropped_events = 0;
+  std::fill(_p->leaf_samples.begin(), _p->leaf_samples.end(), 0);
+  std::fill(_p->running_since.begin(), _p->running_since.end(), -1);
+}
+
+uint64_t SamplingProfiler::samplesCount() const
+{
+  const std::scoped_lock lk(_p->data_mutex);
+  return _p->samples_count;
+}
+
+uint64_t SamplingProfiler::droppedTraceEvents() const
+{
+  const std::scoped_lock lk(_p->data_mutex);
+  return _p->dropped_events;
+}
+
+std::string SamplingProfiler::foldedStacks() const
+{
+  std::vector<std::pair<const std::string*, uint64_t>> stacks;
+  {
+    const std::scoped_lock lk(_p->data_mutex);
+    for(size_t i = 0; i < _p->nodes.size(); i++)
+    {
+      if(_p->leaf_samples[i] > 0)
+      {
+        stacks.emplace_back(&_p->folded_stacks[i], _p->leaf_samples[i]);
+      }
+    }
+  }
+  std::sort(stacks.begin(), stacks.end(),
+            [](const auto& a, const auto& b) { return *a.first < *b.first; });
+
+  std::string output;
+  for(const auto& [stack, samples] : stacks)
+  {
+    output += *stack;
+    output += ' ';
+    output += std::to_string(samples);
+    output += '\n';
+  }
+  return output;
+}
+
+std::string SamplingProfiler::chromeTrace() const
+{
+  nlohmann::json trace_events = nlohmann::json::array();
+  auto addEvent = [&](size_t index, int64_t start_usec, int64_t duration_usec) {
+    const TreeNode& node = *_p->nodes[index];
+    trace_events.push_back({ { "name", node.name() },
+                             { "cat", node.registrationName() },
+                             { "ph", "X" },
+                             { "ts", start_usec },
+                             { "dur", duration_usec },
+                             { "pid", 1 },
+                             { "tid", 1 },
+                             { "args", { { "path", node.fullPath() },
+                                         { "uid", node.UID() } } } });
+  };
+
+  const std::scoped_lock lk(_p->data_mutex);
+  // from the oldest to the newest event
+  const size_t events_count = _p->events.size();
+  for(size_t i = 0; i < events_count; i++)
+  {
+    const auto& event = _p->events[(_p->next_event + i) % events_count];
+    addEvent(event.index, event.start_usec, event.duration_usec);
+  }
+  // nodes still RUNNING at the last sample
+  for(size_t i = 0; i < _p->nodes.size(); i++)
+  {
+    if(_p->running_since[i] >= 0)
+    {
+      addEvent(i, _p->running_since[i], _p->last_sample_usec - _p->running_since[i]);
+    }
+  }
+
+  nlohmann::json trace;
+  trace["traceEvents"] = std::move(trace_events);
+  trace["displayTimeUnit"] = "ms";
+  return trace.dump();
+}
+
+}  // namespace BT
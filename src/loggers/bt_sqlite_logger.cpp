@@ -120,10 +120,14 @@ SqliteLogger::SqliteLogger(const Tree& tree, std::filesystem::path const& filepa
   {
     for(const auto& node : subtree->nodes)
     {
+      if(node->UID() >= starting_time_.size())
+      {
+        starting_time_.resize(size_t(node->UID()) + 1, -1);
+      }
       stmt = prepareStatement(db_, "INSERT INTO Nodes VALUES (?, ?, ?)");
       sqlite3_bind_int(stmt, 1, session_id_);
       sqlite3_bind_text(stmt, 2, node->fullPath().c_str(), -1, SQLITE_TRANSIENT);
-      sqlite3_bind_int(stmt, 3, node->UID());
+      sqlite3_bind_int64(stmt, 3, node->UID());
       execStatement(stmt);
     }
   }
@@ -168,28 +172,8 @@ void SqliteLogger::callback(Duration timestamp, const TreeNode& node,
 {
   using namespace std::chrono;
   const int64_t tm_usec = int64_t(duration_cast<microseconds>(timestamp).count());
-  monotonic_timestamp_ = std::max(monotonic_timestamp_ + 1, tm_usec);
-
-  long elapsed_time = 0;
-
-  if(prev_status == NodeStatus::IDLE && status == NodeStatus::RUNNING)
-  {
-    starting_time_[&node] = monotonic_timestamp_;
-  }
-
-  if(prev_status == NodeStatus::RUNNING && status != NodeStatus::RUNNING)
-  {
-    elapsed_time = monotonic_timestamp_;
-    auto it = starting_time_.find(&node);
-    if(it != starting_time_.end())
-    {
-      elapsed_time -= it->second;
-    }
-  }
 
   Transition trans;
-  trans.timestamp = monotonic_timestamp_;
-  trans.duration = elapsed_time;
   trans.node_uid = node.UID();
   trans.status = status;
 
@@ -199,8 +183,33 @@ void SqliteLogger::callback(Duration timestamp, const TreeNode& node,
   }
 
   {
+    // callback() may be invoked concurrently (for instance, by the children
+    // of a ConcurrentParallel): the timestamps must be assigned under the same
+    // lock that orders the queue, to keep them unique and increasing.
     const std::scoped_lock lk(queue_mutex_);
-    transitions_queue_.push_back(trans);
+    monotonic_timestamp_ = std::max(monotonic_timestamp_ + 1, tm_usec);
+
+    long elapsed_time = 0;
+
+    const bool known_node = node.UID() < starting_time_.size();
+
+    if(known_node && prev_status == NodeStatus::IDLE && status == NodeStatus::RUNNING)
+    {
+      starting_time_[node.UID()] = monotonic_timestamp_;
+    }
+
+    if(prev_status == NodeStatus::RUNNING && status != NodeStatus::RUNNING)
+    {
+      elapsed_time = monotonic_timestamp_;
+      if(known_node && starting_time_[node.UID()] >= 0)
+      {
+        elapsed_time -= starting_time_[node.UID()];
+      }
+    }
+
+    trans.timestamp = monotonic_timestamp_;
+    trans.duration = elapsed_time;
+    transitions_queue_.push_back(std::move(trans));
   }
   queue_cv_.notify_one();
 }
@@ -239,7 +248,7 @@ void SqliteLogger::writerLoop()
                                                  "?, ?, ?, ?)");
       sqlite3_bind_int64(stmt, 1, trans.timestamp);
       sqlite3_bind_int(stmt, 2, session_id_);
-      sqlite3_bind_int(stmt, 3, trans.node_uid);
+      sqlite3_bind_int64(stmt, 3, trans.node_uid);
       sqlite3_bind_int64(stmt, 4, trans.duration);
       sqlite3_bind_int(stmt, 5, static_cast<int>(trans.status));
       sqlite3_bind_text(stmt, 6, trans.extra_data.c_str(), -1, SQLITE_TRANSIENT);
@@ -2,10 +2,16 @@
 
 #include "zmq_addon.hpp"
 
+#include "behaviortree_cpp/json_export.h"
 #include "behaviortree_cpp/loggers/groot2_protocol.h"
 #include "behaviortree_cpp/utils/callback_gate.h"
 #include "behaviortree_cpp/xml_parsing.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <random>
 #include <tuple>
 
 namespace BT
@@ -24,8 +30,8 @@ struct Transition
   // when serializing, we will remove the initial time and serialize only
   // 6 bytes, instead of 8
   uint64_t timestamp_usec;
-  // if you have more than 64.000 nodes, you are doing something wrong :)
-  uint16_t node_uid;
+  // serialized with 2 or 4 bytes. See Monitor::SerializedUIDSize()
+  uint32_t node_uid;
   // enough bits to contain NodeStatus
   uint8_t status;
 
@@ -58,6 +64,261 @@ std::array<char, 16> CreateRandomUUID()
 
   return out;
 }
+
+// The status sequences of a publisher start from its epoch, in the upper bits
+// of the 56 available in node_status. Each publisher has a different epoch,
+// so that a sequence acknowledged to a previous one (for instance, before the
+// executor was restarted) is outside the range of the current one.
+constexpr int kSequenceEpochShift = 40;
+
+uint64_t CreateSequenceEpoch()
+{
+  // random for each process, then different for each publisher of the process
+  static const uint32_t process_epoch = std::random_device{}();
+  static std::atomic<uint32_t> publishers = 0;
+  // 0 is reserved to request a full snapshot
+  return 1 + (process_epoch + publishers.fetch_add(1)) % 0xFFFF;
+}
+
+/**
+ * Minimal MessagePack encoder, used to serialize the blackboards without
+ * creating an intermediate nlohmann::json.
+ */
+class MsgPackWriter
+{
+public:
+  explicit MsgPackWriter(std::string& buffer) : buffer_(buffer)
+  {}
+
+  void writeNil()
+  {
+    buffer_.push_back(char(0xC0));
+  }
+
+  void writeBool(bool value)
+  {
+    buffer_.push_back(char(value ? 0xC3 : 0xC2));
+  }
+
+  void writeUnsigned(uint64_t value)
+  {
+    if(value < 128)
+    {
+      buffer_.push_back(char(value));
+    }
+    else if(value <= std::numeric_limits<uint8_t>::max())
+    {
+      writeTagged(0xCC, uint8_t(value));
+    }
+    else if(value <= std::numeric_limits<uint16_t>::max())
+    {
+      writeTagged(0xCD, uint16_t(value));
+    }
+    else if(value <= std::numeric_limits<uint32_t>::max())
+    {
+      writeTagged(0xCE, uint32_t(value));
+    }
+    else
+    {
+      writeTagged(0xCF, value);
+    }
+  }
+
+  void writeInteger(int64_t value)
+  {
+    if(value >= 0)
+    {
+      writeUnsigned(uint64_t(value));
+    }
+    else if(value >= -32)
+    {
+      buffer_.push_back(char(int8_t(value)));
+    }
+    else if(value >= std::numeric_limits<int8_t>::min())
+    {
+      writeTagged(0xD0, int8_t(value));
+    }
+    else if(value >= std::numeric_limits<int16_t>::min())
+    {
+      writeTagged(0xD1, int16_t(value));
+    }
+    else if(value >= std::numeric_limits<int32_t>::min())
+    {
+      writeTagged(0xD2, int32_t(value));
+    }
+    else
+    {
+      writeTagged(0xD3, value);
+    }
+  }
+
+  void writeDouble(double value)
+  {
+    writeTagged(0xCB, value);
+  }
+
+  void writeString(StringView str)
+  {
+    if(str.size() < 32)
+    {
+      buffer_.push_back(char(0xA0 | str.size()));
+    }
+    else if(str.size() <= std::numeric_limits<uint8_t>::max())
+    {
+      writeTagged(0xD9, uint8_t(str.size()));
+    }
+    else if(str.size() <= std::numeric_limits<uint16_t>::max())
+    {
+      writeTagged(0xDA, uint16_t(str.size()));
+    }
+    else
+    {
+      writeTagged(0xDB, uint32_t(str.size()));
+    }
+    buffer_.append(str.data(), str.size());
+  }
+
+  void writeArrayHeader(uint32_t size)
+  {
+    if(size < 16)
+    {
+      buffer_.push_back(char(0x90 | size));
+    }
+    else if(size <= std::numeric_limits<uint16_t>::max())
+    {
+      writeTagged(0xDC, uint16_t(size));
+    }
+    else
+    {
+      writeTagged(0xDD, size);
+    }
+  }
+
+  void writeMapHeader(uint32_t size)
+  {
+    writeTagged(0xDF, size);
+  }
+
+  /// Write a map header with unknown size, to be fixed with patchMapHeader()
+  size_t reserveMapHeader()
+  {
+    const size_t pos = buffer_.size();
+    writeMapHeader(0);
+    return pos;
+  }
+
+  void patchMapHeader(size_t pos, uint32_t size)
+  {
+    writeBigEndian(&buffer_[pos + 1], size);
+  }
+
+  template <typename T>
+  void writeArray(const std::vector<T>& values)
+  {
+    writeArrayHeader(uint32_t(values.size()));
+    for(const auto& value : values)
+    {
+      if constexpr(std::is_same_v<T, bool>)
+      {
+        writeBool(value);
+      }
+      else if constexpr(std::is_same_v<T, std::string>)
+      {
+        writeString(value);
+      }
+      else if constexpr(std::is_floating_point_v<T>)
+      {
+        writeDouble(value);
+      }
+      else
+      {
+        writeInteger(value);
+      }
+    }
+  }
+
+  /// Same conversions of JsonExporter::toJson(). Types registered by the user
+  /// still need a nlohmann::json, but only for the value being encoded.
+  void writeAny(const Any& any)
+  {
+    auto const& type = any.castedType();
+    if(any.empty())
+    {
+      writeNil();
+    }
+    else if(any.isString())
+    {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      auto* str = const_cast<Any&>(any).castPtr<SafeAny::SimpleString>();
+      writeString(StringView(str->data(), str->size()));
+    }
+    else if(type == typeid(int64_t))
+    {
+      writeInteger(any.cast<int64_t>());
+    }
+    else if(type == typeid(uint64_t))
+    {
+      writeUnsigned(any.cast<uint64_t>());
+    }
+    else if(type == typeid(double))
+    {
+      writeDouble(any.cast<double>());
+    }
+    else if(!writeVector<double, int, std::string, bool>(any))
+    {
+      nlohmann::json json;
+      JsonExporter::get().toJson(any, json);
+      nlohmann::json::to_msgpack(json, nlohmann::detail::output_adapter<char>(buffer_));
+    }
+  }
+
+private:
+  template <typename... T>
+  bool writeVector(const Any& any)
+  {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    auto& mutable_any = const_cast<Any&>(any);
+    auto tryWrite = [&](auto* ptr) {
+      if(ptr != nullptr)
+      {
+        writeArray(*ptr);
+        return true;
+      }
+      return false;
+    };
+    return (tryWrite(mutable_any.castPtr<std::vector<T>>()) || ...);
+  }
+
+  template <typename T>
+  void writeTagged(uint8_t tag, T value)
+  {
+    buffer_.push_back(char(tag));
+    buffer_.resize(buffer_.size() + sizeof(T));
+    writeBigEndian(&buffer_[buffer_.size() - sizeof(T)], value);
+  }
+
+  template <typename T>
+  static void writeBigEndian(char* dst, T value)
+  {
+    std::array<char, sizeof(T)> bytes{};
+    std::memcpy(bytes.data(), &value, sizeof(T));
+    for(size_t i = 0; i < sizeof(T); i++)
+    {
+      // MessagePack is big-endian
+      dst[i] = bytes[IsLittleEndian() ? sizeof(T) - 1 - i : i];
+    }
+  }
+
+  static bool IsLittleEndian()
+  {
+    const uint16_t value = 1;
+    uint8_t first_byte = 0;
+    std::memcpy(&first_byte, &value, 1);
+    return first_byte == 1;
+  }
+
+  std::string& buffer_;
+};
 }  // namespace
 
 struct Groot2Publisher::PImpl
@@ -79,6 +340,30 @@ struct Groot2Publisher::PImpl
   /// Body of the pre/post tick callback installed by insertHook().
   NodeStatus runHook(const Monitor::Hook::Ptr& hook, TreeNode& node);
 
+  /// Wait until no status change is in progress and return the current sequence.
+  /// All the changes with a sequence lower or equal are visible to the caller.
+  uint64_t waitStatusSequence() const;
+
+  /// Append the (node_uid, status) pair of the node at the given index.
+  void appendStatus(std::string& buffer, size_t index) const;
+
+  /// Append a node_uid, serialized as required by the protocol.
+  void appendUID(std::string& buffer, uint32_t node_uid) const;
+
+  /// The node with the given UID, if it still exists.
+  TreeNode::Ptr findNode(uint32_t node_uid) const;
+
+  /// Copy the keys and the entries of a blackboard into entries_buffer.
+  void collectEntries(const Blackboard& blackboard);
+
+  /// Write the entries of entries_buffer as a MessagePack map. If changed_after
+  /// is not null, skip the ones not modified after that time (steady_clock).
+  void dumpEntries(MsgPackWriter& writer, const std::chrono::nanoseconds* changed_after);
+
+  /// The sequence at which the set of entries of the blackboard, collected
+  /// in entries_buffer, was seen changing for the last time.
+  uint64_t entriesChangedAt(const std::string& bb_name, uint64_t sequence);
+
   unsigned server_port = 0;
   std::string server_address;
   std::string publisher_address;
@@ -88,25 +373,53 @@ struct Groot2Publisher::PImpl
   std::atomic_bool active_server = true;
   std::thread server_thread;
 
+  // protects the recording state
   std::mutex status_mutex;
 
-  std::string status_buffer;
-  // each element of this map points to a character in _p->status_buffer
-  std::unordered_map<uint16_t, char*> status_buffermap;
+  // Monitor::kProtocolID, unless the tree has UIDs larger than 16 bits
+  uint8_t protocol = Monitor::kProtocolID;
+  // UID of the node at each index of node_status
+  std::vector<uint32_t> node_uids;
+  // index of each node in node_status, indexed by UID
+  std::vector<uint32_t> status_index;
+  // For each node, the sequence number of its last change (upper 56 bits)
+  // and its status (lower 8 bits). Written by callback() without locking.
+  std::unique_ptr<std::atomic<uint64_t>[]> node_status;
+  size_t node_count = 0;
+  // The first sequence of this publisher: the ones acknowledged by a client
+  // are unknown if lower than this or larger than changes_started.
+  uint64_t first_sequence = CreateSequenceEpoch() << kSequenceEpochShift;
+  // Number of status changes started and completed, counted from first_sequence.
+  // They are equal when no change is in progress.
+  std::atomic<uint64_t> changes_started = first_sequence;
+  std::atomic<uint64_t> changes_completed = first_sequence;
+
+  // Used only by the server thread, to create the BLACKBOARD replies
+  std::string blackboard_buffer;
+  std::vector<std::pair<std::string, std::shared_ptr<Blackboard::Entry>>> entries_buffer;
+  // For each blackboard, a hash of its keys and entries and the sequence at
+  // which it changed. It doesn't depend on the clients: it is only observed.
+  struct EntriesSet
+  {
+    uint64_t signature = 0;
+    uint64_t changed_at = 0;
+  };
+  std::unordered_map<std::string, EntriesSet> entries_sets;
 
   // weak reference to the tree.
   std::unordered_map<std::string, std::weak_ptr<BT::Tree::Subtree>> subtrees;
-  std::unordered_map<uint16_t, std::weak_ptr<BT::TreeNode>> nodes_by_uid;
+  // dense array, indexed by UID
+  std::vector<std::weak_ptr<BT::TreeNode>> nodes_by_uid;
 
   std::mutex hooks_map_mutex;
-  std::unordered_map<uint16_t, Monitor::Hook::Ptr> pre_hooks;
-  std::unordered_map<uint16_t, Monitor::Hook::Ptr> post_hooks;
+  std::unordered_map<uint32_t, Monitor::Hook::Ptr> pre_hooks;
+  std::unordered_map<uint32_t, Monitor::Hook::Ptr> post_hooks;
 
   std::mutex last_heartbeat_mutex;
   std::chrono::steady_clock::time_point last_heartbeat = std::chrono::steady_clock::now();
   std::chrono::milliseconds max_heartbeat_delay = std::chrono::milliseconds(5000);
 
-  bool recording = false;
+  std::atomic_bool recording = false;
   std::deque<Transition> transitions_buffer;
   std::chrono::microseconds recording_fist_time{};
 
@@ -127,16 +440,23 @@ Groot2Publisher::Groot2Publisher(const BT::Tree& tree, unsigned server_port)
   _p->tree_xml = WriteTreeToXML(tree, true, true);
 
   //-------------------------------
-  // Prepare the status buffer
+  // Prepare the status of the nodes
   size_t node_count = 0;
+  uint32_t max_uid = 0;
   for(const auto& subtree : tree.subtrees)
   {
     node_count += subtree->nodes.size();
+    for(const auto& node : subtree->nodes)
+    {
+      max_uid = std::max(max_uid, node->UID());
+    }
   }
-  _p->status_buffer.resize(3 * node_count);
-
-  unsigned ptr_offset = 0;
-  char* buffer_ptr = _p->status_buffer.data();
+  _p->protocol = Monitor::ProtocolForMaxUID(max_uid);
+  _p->node_count = node_count;
+  _p->node_status = std::make_unique<std::atomic<uint64_t>[]>(node_count);
+  _p->node_uids.reserve(node_count);
+  _p->nodes_by_uid.resize(size_t(max_uid) + 1);
+  _p->status_index.resize(size_t(max_uid) + 1, std::numeric_limits<uint32_t>::max());
 
   for(const auto& subtree : tree.subtrees)
   {
@@ -146,11 +466,11 @@ Groot2Publisher::Groot2Publisher(const BT::Tree& tree, unsigned server_port)
 
     for(const auto& node : subtree->nodes)
     {
-      _p->nodes_by_uid.insert({ node->UID(), node });
-
-      ptr_offset += Monitor::Serialize(buffer_ptr, ptr_offset, node->UID());
-      _p->status_buffermap.insert({ node->UID(), buffer_ptr + ptr_offset });
-      ptr_offset += Monitor::Serialize(buffer_ptr, ptr_offset, uint8_t(NodeStatus::IDLE));
+      const auto index = static_cast<uint32_t>(_p->node_uids.size());
+      _p->nodes_by_uid[node->UID()] = node;
+      _p->status_index[node->UID()] = index;
+      _p->node_status[index] = (_p->first_sequence << 8) | uint8_t(NodeStatus::IDLE);
+      _p->node_uids.push_back(node->UID());
     }
   }
   //-------------------------------
@@ -222,15 +542,29 @@ Groot2Publisher::~Groot2Publisher()
 void Groot2Publisher::callback(Duration ts, const TreeNode& node, NodeStatus prev_status,
                                NodeStatus new_status)
 {
-  const std::unique_lock<std::mutex> lk(_p->status_mutex);
-  auto status = static_cast<char>(new_status);
+  auto status = static_cast<uint8_t>(new_status);
 
   if(new_status == NodeStatus::IDLE)
   {
-    status = static_cast<char>(10 + static_cast<int>(prev_status));
+    status = static_cast<uint8_t>(10 + static_cast<int>(prev_status));
   }
-  *(_p->status_buffermap.at(node.UID())) = status;
 
+  // This is executed by the tick thread: a few atomic operations, no locks.
+  const uint32_t index = node.UID() < _p->status_index.size() ?
+                             _p->status_index[node.UID()] :
+                             std::numeric_limits<uint32_t>::max();
+  if(index < _p->node_count)
+  {
+    const uint64_t sequence = _p->changes_started.fetch_add(1) + 1;
+    _p->node_status[index].store((sequence << 8) | status, std::memory_order_release);
+    _p->changes_completed.fetch_add(1, std::memory_order_release);
+  }
+
+  if(!_p->recording.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+  const std::unique_lock<std::mutex> lk(_p->status_mutex);
   if(_p->recording)
   {
     Transition trans{};
@@ -305,7 +639,7 @@ void Groot2Publisher::serverLoop()
 
     Monitor::ReplyHeader reply_header;
     reply_header.request = request_header;
-    reply_header.request.protocol = Monitor::kProtocolID;
+    reply_header.request.protocol = _p->protocol;
     reply_header.tree_id = serialized_uuid;
 
     zmq::multipart_t reply_msg;
@@ -321,8 +655,26 @@ void Groot2Publisher::serverLoop()
         break;
 
         case Monitor::RequestType::STATUS: {
-          const std::unique_lock<std::mutex> lk(_p->status_mutex);
-          reply_msg.addstr(_p->status_buffer);
+          thread_local std::string snapshot;
+          snapshot.clear();
+          std::ignore = _p->waitStatusSequence();
+          for(size_t index = 0; index < _p->node_count; index++)
+          {
+            _p->appendStatus(snapshot, index);
+          }
+          reply_msg.addstr(snapshot);
+        }
+        break;
+
+        case Monitor::RequestType::STATUS_DELTA: {
+          if(requestMsg.size() != 2 || requestMsg[1].size() != sizeof(uint64_t))
+          {
+            sendErrorReply("must be 2 parts message, with a 8 bytes sequence");
+            continue;
+          }
+          uint64_t acknowledged = 0;
+          Monitor::Deserialize(requestMsg[1].data<char>(), 0, acknowledged);
+          reply_msg.addstr(generateStatusDelta(acknowledged));
         }
         break;
 
@@ -333,7 +685,28 @@ void Groot2Publisher::serverLoop()
             continue;
           }
           std::string const bb_names_str = requestMsg[1].to_string();
-          auto msg = generateBlackboardsDump(bb_names_str);
+          auto msg = generateBlackboardsDump(bb_names_str, DumpMode::FULL);
+          if(!msg)
+          {
+            sendErrorReply(msg.error());
+            continue;
+          }
+          auto const& payload = msg.value();
+          reply_msg.addmem(payload.data(), payload.size());
+        }
+        break;
+
+        case Monitor::RequestType::BLACKBOARD_DELTA: {
+          if(requestMsg.size() != 2 || requestMsg[1].size() < sizeof(uint64_t))
+          {
+            sendErrorReply("must be 2 parts message, starting with a 8 bytes sequence");
+            continue;
+          }
+          std::string const request_str = requestMsg[1].to_string();
+          uint64_t acknowledged = 0;
+          Monitor::Deserialize(request_str.data(), 0, acknowledged);
+          auto msg = generateBlackboardsDump(request_str.substr(sizeof(uint64_t)),
+                                             DumpMode::DELTA, acknowledged);
           if(!msg)
           {
             sendErrorReply(msg.error());
@@ -352,7 +725,7 @@ void Groot2Publisher::serverLoop()
           }
 
           auto InsertHook = [this](nlohmann::json const& json) {
-            uint16_t const node_uid = json.at("uid").get<uint16_t>();
+            uint32_t const node_uid = json.at("uid").get<uint32_t>();
             Position const pos = static_cast<Position>(json.at("position").get<int>());
 
             if(auto hook = getHook(pos, node_uid))
@@ -403,7 +776,7 @@ void Groot2Publisher::serverLoop()
           }
 
           auto json = nlohmann::json::parse(requestMsg[1].to_string());
-          const uint16_t node_uid = json.at("uid").get<uint16_t>();
+          const uint32_t node_uid = json.at("uid").get<uint32_t>();
           const std::string status_str = json.at("desired_status").get<std::string>();
           auto position = static_cast<Position>(json.at("position").get<int>());
           const bool remove = json.at("remove_when_done").get<bool>();
@@ -444,7 +817,7 @@ void Groot2Publisher::serverLoop()
           }
 
           auto json = nlohmann::json::parse(requestMsg[1].to_string());
-          const uint16_t node_uid = json.at("uid").get<uint16_t>();
+          const uint32_t node_uid = json.at("uid").get<uint32_t>();
           auto position = static_cast<Position>(json.at("position").get<int>());
 
           if(!removeHook(position, node_uid))
@@ -512,18 +885,15 @@ void Groot2Publisher::serverLoop()
             std::swap(transitions, _p->transitions_buffer);
           }
           thread_local std::string trans_buffer;
-          trans_buffer.resize(9 * transitions.size());
-          size_t offset = 0;
+          trans_buffer.clear();
+          trans_buffer.reserve((7 + sizeof(uint32_t)) * transitions.size());
           for(const auto& trans : transitions)
           {
-            std::memcpy(&trans_buffer[offset], &trans.timestamp_usec, 6);
-            offset += 6;
-            std::memcpy(&trans_buffer[offset], &trans.node_uid, 2);
-            offset += 2;
-            std::memcpy(&trans_buffer[offset], &trans.status, 1);
-            offset += 1;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            trans_buffer.append(reinterpret_cast<const char*>(&trans.timestamp_usec), 6);
+            _p->appendUID(trans_buffer, trans.node_uid);
+            trans_buffer.push_back(static_cast<char>(trans.status));
           }
-          trans_buffer.resize(offset);
           reply_msg.addstr(trans_buffer);
         }
         break;
@@ -609,10 +979,83 @@ void Groot2Publisher::heartbeatLoop()
   }
 }
 
-Expected<std::vector<uint8_t>>
-Groot2Publisher::generateBlackboardsDump(const std::string& bb_list)
+std::string Groot2Publisher::generateStatusDelta(uint64_t acknowledged_sequence)
+{
+  thread_local std::string delta_buffer;
+
+  // Changes happening while we read node_status have a sequence number larger
+  // than this one: if not included in this reply, they will be in the next one.
+  const uint64_t sequence = _p->waitStatusSequence();
+  // the client is out of sync (or never synced, or synced with another
+  // publisher): send everything
+  const bool full_snapshot =
+      acknowledged_sequence < _p->first_sequence || acknowledged_sequence > sequence;
+
+  delta_buffer.resize(Monitor::StatusDeltaHeader::size());
+  unsigned offset = 0;
+  offset += Monitor::Serialize(delta_buffer.data(), offset, sequence);
+  Monitor::Serialize(delta_buffer.data(), offset, uint8_t(full_snapshot ? 1 : 0));
+
+  for(size_t index = 0; index < _p->node_count; index++)
+  {
+    const uint64_t changed = _p->node_status[index].load(std::memory_order_acquire) >> 8;
+    if(full_snapshot || changed > acknowledged_sequence)
+    {
+      _p->appendStatus(delta_buffer, index);
+    }
+  }
+  return delta_buffer;
+}
+
+uint64_t Groot2Publisher::PImpl::waitStatusSequence() const
+{
+  while(true)
+  {
+    // read "completed" first: it can never be larger than "started"
+    const uint64_t completed = changes_completed.load(std::memory_order_acquire);
+    const uint64_t started = changes_started.load(std::memory_order_acquire);
+    if(completed == started)
+    {
+      return started;
+    }
+    std::this_thread::yield();
+  }
+}
+
+void Groot2Publisher::PImpl::appendStatus(std::string& buffer, size_t index) const
+{
+  const auto status =
+      static_cast<char>(node_status[index].load(std::memory_order_acquire) & 0xFF);
+  appendUID(buffer, node_uids[index]);
+  buffer.push_back(status);
+}
+
+void Groot2Publisher::PImpl::appendUID(std::string& buffer, uint32_t node_uid) const
+{
+  std::array<char, sizeof(uint32_t)> bytes{};
+  if(protocol == Monitor::kProtocolIDWideUID)
+  {
+    Monitor::Serialize(bytes.data(), 0, node_uid);
+  }
+  else
+  {
+    Monitor::Serialize(bytes.data(), 0, static_cast<uint16_t>(node_uid));
+  }
+  buffer.append(bytes.data(), Monitor::SerializedUIDSize(protocol));
+}
+
+TreeNode::Ptr Groot2Publisher::PImpl::findNode(uint32_t node_uid) const
+{
+  return node_uid < nodes_by_uid.size() ? nodes_by_uid[node_uid].lock() : nullptr;
+}
+
+Expected<StringView> Groot2Publisher::generateBlackboardsDump(const std::string& bb_list,
+                                                              DumpMode mode,
+                                                              uint64_t acknowledged_sequence)
 {
-  auto json = nlohmann::json();
+  std::vector<std::pair<std::string, const Blackboard*>> blackboards;
+  // keep the subtrees (and their blackboards) alive while dumping
+  std::vector<std::shared_ptr<Tree::Subtree>> locked_subtrees;
   const Blackboard* exported_root = nullptr;
 
   auto const bb_names = BT::splitString(bb_list, ';');
@@ -638,7 +1081,12 @@ Groot2Publisher::generateBlackboardsDump(const std::string& bb_list)
                                          "external root blackboard export");
         }
 
-        json[bb_name] = ExportBlackboardToJSON(*local_bb);
+        auto same_name = [&bb_name](const auto& item) { return item.first == bb_name; };
+        if(std::none_of(blackboards.begin(), blackboards.end(), same_name))
+        {
+          blackboards.emplace_back(bb_name, local_bb);
+        }
+        locked_subtrees.push_back(std::move(subtree));
 
         if(needs_exported_root)
         {
@@ -651,30 +1099,144 @@ Groot2Publisher::generateBlackboardsDump(const std::string& bb_list)
             return nonstd::make_unexpected("blackboard dump request spans "
                                            "multiple external root blackboards");
           }
-          if(json.contains(kRootBlackboardName))
+          auto is_root = [](const auto& item) { return item.first == kRootBlackboardName; };
+          if(std::any_of(blackboards.begin(), blackboards.end(), is_root))
           {
             return nonstd::make_unexpected("blackboard dump request would "
                                            "overwrite subtree [ROOT] with an "
                                            "external root blackboard export");
           }
-          json[kRootBlackboardName] = ExportBlackboardToJSON(*root_bb);
+          blackboards.emplace_back(kRootBlackboardName, root_bb);
           exported_root = root_bb;
         }
       }
     }
   }
-  return nlohmann::json::to_msgpack(json);
+
+  std::string& buffer = _p->blackboard_buffer;
+  buffer.clear();
+  MsgPackWriter writer(buffer);
+
+  if(mode == DumpMode::FULL)
+  {
+    writer.writeMapHeader(uint32_t(blackboards.size()));
+    for(const auto& [bb_name, blackboard] : blackboards)
+    {
+      writer.writeString(bb_name);
+      _p->collectEntries(*blackboard);
+      _p->dumpEntries(writer, nullptr);
+    }
+    return StringView(buffer);
+  }
+
+  // The entries are modified with the timestamp of the steady_clock, taken
+  // while they are locked: the ones modified while we read them have a
+  // timestamp larger than "sequence" or, if equal, they are sent again next time.
+  const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch());
+  const uint64_t sequence = uint64_t(now.count()) - 1;
+  // the client is out of sync (or never synced): send everything
+  const bool send_all = acknowledged_sequence == 0 || acknowledged_sequence > sequence;
+  const std::chrono::nanoseconds changed_after(acknowledged_sequence);
+
+  std::vector<std::string> complete_blackboards;
+  writer.writeMapHeader(uint32_t(blackboards.size() + 2));
+  for(const auto& [bb_name, blackboard] : blackboards)
+  {
+    writer.writeString(bb_name);
+    _p->collectEntries(*blackboard);
+    // if entries were added or removed, the client must replace all of them
+    const bool complete =
+        _p->entriesChangedAt(bb_name, sequence) > acknowledged_sequence || send_all;
+    _p->dumpEntries(writer, complete ? nullptr : &changed_after);
+    if(complete)
+    {
+      complete_blackboards.push_back(bb_name);
+    }
+  }
+  writer.writeString(Monitor::kSequenceKey);
+  writer.writeUnsigned(sequence);
+  writer.writeString(Monitor::kCompleteBlackboardsKey);
+  writer.writeArrayHeader(uint32_t(complete_blackboards.size()));
+  for(const auto& bb_name : complete_blackboards)
+  {
+    writer.writeString(bb_name);
+  }
+  return StringView(buffer);
 }
 
-bool Groot2Publisher::insertHook(std::shared_ptr<Monitor::Hook> hook)
+void Groot2Publisher::PImpl::collectEntries(const Blackboard& blackboard)
 {
-  auto const node_uid = hook->node_uid;
-  auto it = _p->nodes_by_uid.find(node_uid);
-  if(it == _p->nodes_by_uid.end())
+  // getKeys() returns views into the storage: copy them, because
+  // the storage might change while we dump the entries
+  entries_buffer.clear();
+  for(const auto& key : blackboard.getKeys())
   {
-    return false;
+    entries_buffer.emplace_back(std::string(key), nullptr);
+  }
+  for(auto& [key, entry] : entries_buffer)
+  {
+    entry = blackboard.getEntry(key);
+  }
+}
+
+void Groot2Publisher::PImpl::dumpEntries(MsgPackWriter& writer,
+                                         const std::chrono::nanoseconds* changed_after)
+{
+  // The number of entries is known only at the end
+  const size_t map_header = writer.reserveMapHeader();
+  uint32_t count = 0;
+
+  for(const auto& [key, entry] : entries_buffer)
+  {
+    if(!entry)
+    {
+      continue;
+    }
+    // lock one entry at a time
+    const std::unique_lock lk(entry->entry_mutex);
+    if(changed_after != nullptr && entry->stamp <= *changed_after)
+    {
+      continue;
+    }
+    writer.writeString(key);
+    writer.writeAny(entry->value);
+    count++;
   }
-  const TreeNode::Ptr node = it->second.lock();
+  writer.patchMapHeader(map_header, count);
+}
+
+uint64_t Groot2Publisher::PImpl::entriesChangedAt(const std::string& bb_name,
+                                                  uint64_t sequence)
+{
+  // order-independent hash of the keys and of the addresses of the entries
+  // (an entry removed and created again is a different one)
+  auto mix = [](uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  };
+  uint64_t signature = entries_buffer.size();
+  for(const auto& [key, entry] : entries_buffer)
+  {
+    if(entry)
+    {
+      signature += mix(std::hash<std::string>{}(key) ^
+                       mix(reinterpret_cast<uintptr_t>(entry.get())));
+    }
+  }
+  auto [it, inserted] = entries_sets.try_emplace(bb_name);
+  if(inserted || it->second.signature != signature)
+  {
+    it->second = { signature, sequence };
+  }
+  return it->second.changed_at;
+}
+
+bool Groot2Publisher::insertHook(std::shared_ptr<Monitor::Hook> hook)
+{
+  auto const node_uid = hook->node_uid;
+  const TreeNode::Ptr node = _p->findNode(node_uid);
   if(!node)
   {
     return false;
@@ -784,15 +1346,10 @@ NodeStatus Groot2Publisher::PImpl::runHook(const Monitor::Hook::Ptr& hook, TreeN
   return desired_status;
 }
 
-bool Groot2Publisher::unlockBreakpoint(Position pos, uint16_t node_uid, NodeStatus result,
+bool Groot2Publisher::unlockBreakpoint(Position pos, uint32_t node_uid, NodeStatus result,
                                        bool remove)
 {
-  auto it = _p->nodes_by_uid.find(node_uid);
-  if(it == _p->nodes_by_uid.end())
-  {
-    return false;
-  }
-  const TreeNode::Ptr node = it->second.lock();
+  const TreeNode::Ptr node = _p->findNode(node_uid);
   if(!node)
   {
     return false;
@@ -818,14 +1375,9 @@ bool Groot2Publisher::unlockBreakpoint(Position pos, uint16_t node_uid, NodeStat
   return true;
 }
 
-bool Groot2Publisher::removeHook(Position pos, uint16_t node_uid)
+bool Groot2Publisher::removeHook(Position pos, uint32_t node_uid)
 {
-  auto it = _p->nodes_by_uid.find(node_uid);
-  if(it == _p->nodes_by_uid.end())
-  {
-    return false;
-  }
-  const TreeNode::Ptr node = it->second.lock();
+  const TreeNode::Ptr node = _p->findNode(node_uid);
   if(!node)
   {
     return false;
@@ -872,7 +1424,7 @@ bool Groot2Publisher::removeHook(Position pos, uint16_t node_uid)
 
 void Groot2Publisher::removeAllHooks()
 {
-  std::vector<uint16_t> uids;
+  std::vector<uint32_t> uids;
 
   for(auto pos : { Position::PRE, Position::POST })
   {
@@ -897,7 +1449,7 @@ void Groot2Publisher::removeAllHooks()
   }
 }
 
-Monitor::Hook::Ptr Groot2Publisher::getHook(Position pos, uint16_t node_uid)
+Monitor::Hook::Ptr Groot2Publisher::getHook(Position pos, uint32_t node_uid)
 {
   auto* hooks = pos == Position::PRE ? &_p->pre_hooks : &_p->post_hooks;
   const std::unique_lock<std::mutex> lk(_p->hooks_map_mutex);
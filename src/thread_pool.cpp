@@ -0,0 +1,66 @@
+#include "behaviortree_cpp/utils/thread_pool.h"
+
+#include <algorithm>
+
+namespace BT
+{
+
+ThreadPool::ThreadPool(size_t threads)
+{
+  threads = std::max<size_t>(threads, 1);
+  workers_.reserve(threads);
+  for(size_t i = 0; i < threads; i++)
+  {
+    workers_.emplace_back(&ThreadPool::workerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    const std::scoped_lock lk(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for(auto& worker : workers_)
+  {
+    worker.join();
+  }
+}
+
+void ThreadPool::post(std::function<void()> task)
+{
+  {
+    const std::scoped_lock lk(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  cv_.notify_one();
+}
+
+ThreadPool& ThreadPool::shared()
+{
+  static ThreadPool pool(std::thread::hardware_concurrency());
+  return pool;
+}
+
+void ThreadPool::workerLoop()
+{
+  while(true)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock lk(mutex_);
+      cv_.wait(lk, [this]() { return stop_ || !tasks_.empty(); });
+      if(tasks_.empty())
+      {
+        // stop_ is true and there is nothing left to do
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+}  // namespace BT
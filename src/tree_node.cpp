@@ -16,6 +16,9 @@
 #include <array>
 #include <atomic>
 #include <cstring>
+#include <forward_list>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace BT
@@ -29,7 +32,8 @@ struct TreeNode::PImpl
 
   const std::string name;
 
-  NodeStatus status = NodeStatus::IDLE;
+  // written while holding state_mutex, but it can be read without locking
+  std::atomic<NodeStatus> status = NodeStatus::IDLE;
 
   std::condition_variable state_condition_variable;
 
@@ -44,13 +48,56 @@ struct TreeNode::PImpl
   PreTickCallback pre_tick_callback;
   PostTickCallback post_tick_callback;
   TickMonitorCallback tick_monitor_callback;
+  // copy-on-write: the tick copies only the pointer. Null if empty
+  using TickMonitorList = std::vector<std::weak_ptr<TickMonitorCallback>>;
+  std::shared_ptr<const TickMonitorList> tick_monitor_subscribers;
 
   std::mutex callback_injection_mutex;
 
+  // replace tick_monitor_subscribers with a copy without the expired
+  // subscribers, plus new_subscriber (if not null)
+  void updateTickMonitors(const TickMonitorSubscriber& new_subscriber)
+  {
+    const std::unique_lock lk(callback_injection_mutex);
+    auto subscribers = std::make_shared<TickMonitorList>();
+    if(tick_monitor_subscribers)
+    {
+      for(const auto& weak_subscriber : *tick_monitor_subscribers)
+      {
+        if(!weak_subscriber.expired())
+        {
+          subscribers->push_back(weak_subscriber);
+        }
+      }
+    }
+    if(new_subscriber)
+    {
+      subscribers->push_back(new_subscriber);
+    }
+    if(subscribers->empty())
+    {
+      subscribers.reset();
+    }
+    tick_monitor_subscribers = std::move(subscribers);
+  }
+
   std::shared_ptr<WakeUpSignal> wake_up;
 
+  std::shared_ptr<TickDeadline> tick_deadline;
+
+  std::shared_ptr<Clock> clock = Clock::realTime();
+
   std::array<ScriptFunction, size_t(PreCond::COUNT_)> pre_parsed;
   std::array<ScriptFunction, size_t(PostCond::COUNT_)> post_parsed;
+
+  struct LiteralPort
+  {
+    std::string literal;
+    // shared with the readers: modifyPortsRemapping() may clear the map
+    std::shared_ptr<const linb::any> value;
+  };
+  mutable std::unordered_map<std::string, std::forward_list<LiteralPort>> literal_ports;
+  mutable std::mutex literal_ports_mutex;
 };
 
 TreeNode::TreeNode(std::string name, NodeConfig config)
@@ -70,15 +117,17 @@ TreeNode::~TreeNode() = default;
 
 NodeStatus TreeNode::executeTick()
 {
-  auto new_status = _p->status;
+  NodeStatus new_status = _p->status.load();
   PreTickCallback pre_tick;
   PostTickCallback post_tick;
   TickMonitorCallback monitor_tick;
+  std::shared_ptr<const PImpl::TickMonitorList> monitor_subscribers;
   {
     const std::scoped_lock lk(_p->callback_injection_mutex);
     pre_tick = _p->pre_tick_callback;
     post_tick = _p->post_tick_callback;
     monitor_tick = _p->tick_monitor_callback;
+    monitor_subscribers = _p->tick_monitor_subscribers;
   }
 
   // a pre-condition may return the new status.
@@ -126,9 +175,33 @@ NodeStatus TreeNode::executeTick()
       }
       std::atomic_thread_fence(std::memory_order_seq_cst);
       const auto t2 = steady_clock::now();
+      const auto duration = duration_cast<microseconds>(t2 - t1);
       if(monitor_tick)
       {
-        monitor_tick(*this, new_status, duration_cast<microseconds>(t2 - t1));
+        monitor_tick(*this, new_status, duration);
+      }
+      if(monitor_subscribers)
+      {
+        bool expired_subscribers = false;
+        for(const auto& weak_subscriber : *monitor_subscribers)
+        {
+          if(auto subscriber = weak_subscriber.lock())
+          {
+            (*subscriber)(*this, new_status, duration);
+          }
+          else
+          {
+            expired_subscribers = true;
+          }
+        }
+        if(expired_subscribers)
+        {
+          _p->updateTickMonitors(nullptr);
+        }
+      }
+      if(_p->tick_deadline)
+      {
+        _p->tick_deadline->checkOverrun(UID(), t2);
       }
     }
   }
@@ -180,13 +253,12 @@ void TreeNode::setStatus(NodeStatus new_status)
   NodeStatus prev_status = NodeStatus::IDLE;
   {
     const std::unique_lock<std::mutex> UniqueLock(_p->state_mutex);
-    prev_status = _p->status;
-    _p->status = new_status;
+    prev_status = _p->status.exchange(new_status);
   }
   if(prev_status != new_status)
   {
     _p->state_condition_variable.notify_all();
-    _p->state_change_signal.notify(std::chrono::high_resolution_clock::now(), *this,
+    _p->state_change_signal.notify(_p->clock->now(), *this,
                                    prev_status, new_status);
   }
 }
@@ -282,25 +354,28 @@ void TreeNode::checkPostConditions(NodeStatus status)
 
 void TreeNode::resetStatus()
 {
+  // most of the nodes reset by their parents are IDLE already
+  if(_p->status.load() == NodeStatus::IDLE)
+  {
+    return;
+  }
   NodeStatus prev_status = NodeStatus::IDLE;
   {
     const std::unique_lock<std::mutex> lock(_p->state_mutex);
-    prev_status = _p->status;
-    _p->status = NodeStatus::IDLE;
+    prev_status = _p->status.exchange(NodeStatus::IDLE);
   }
 
   if(prev_status != NodeStatus::IDLE)
   {
     _p->state_condition_variable.notify_all();
-    _p->state_change_signal.notify(std::chrono::high_resolution_clock::now(), *this,
+    _p->state_change_signal.notify(_p->clock->now(), *this,
                                    prev_status, NodeStatus::IDLE);
   }
 }
 
 NodeStatus TreeNode::status() const
 {
-  const std::lock_guard<std::mutex> lock(_p->state_mutex);
-  return _p->status;
+  return _p->status.load();
 }
 
 NodeStatus TreeNode::waitValidStatus()
@@ -348,7 +423,15 @@ void TreeNode::setTickMonitorCallback(TickMonitorCallback callback)
   _p->tick_monitor_callback = std::move(callback);
 }
 
-uint16_t TreeNode::UID() const
+TreeNode::TickMonitorSubscriber
+TreeNode::subscribeToTickMonitor(TickMonitorCallback callback)
+{
+  auto subscriber = std::make_shared<TickMonitorCallback>(std::move(callback));
+  _p->updateTickMonitors(subscriber);
+  return subscriber;
+}
+
+uint32_t TreeNode::UID() const
 {
   return _p->config.uid;
 }
@@ -461,8 +544,32 @@ void TreeNode::setWakeUpInstance(std::shared_ptr<WakeUpSignal> instance)
   _p->wake_up = instance;
 }
 
+bool TreeNode::tickDeadlineExpired() const
+{
+  return _p->tick_deadline && _p->tick_deadline->expired();
+}
+
+void TreeNode::setTickDeadlineInstance(std::shared_ptr<TickDeadline> instance)
+{
+  _p->tick_deadline = std::move(instance);
+}
+
+const std::shared_ptr<Clock>& TreeNode::clock() const
+{
+  return _p->clock;
+}
+
+void TreeNode::setClockInstance(std::shared_ptr<Clock> instance)
+{
+  _p->clock = std::move(instance);
+}
+
 void TreeNode::modifyPortsRemapping(const PortsRemapping& new_remapping)
 {
+  {
+    const std::scoped_lock lk(_p->literal_ports_mutex);
+    _p->literal_ports.clear();
+  }
   for(const auto& new_it : new_remapping)
   {
     auto it = _p->config.input_ports.find(new_it.first);
@@ -478,6 +585,137 @@ void TreeNode::modifyPortsRemapping(const PortsRemapping& new_remapping)
   }
 }
 
+Expected<StringView> TreeNode::getOutputBlackboardKey(const std::string& key,
+                                                      bool is_any_type)
+{
+  if(!_p->config.blackboard)
+  {
+    return nonstd::make_unexpected("setOutput() failed: trying to access a "
+                                   "Blackboard(BB) entry, but BB is invalid");
+  }
+
+  auto remap_it = _p->config.output_ports.find(key);
+  if(remap_it == _p->config.output_ports.end())
+  {
+    return nonstd::make_unexpected(StrCat("setOutput() failed: "
+                                          "NodeConfig::output_ports "
+                                          "does not contain the key: [",
+                                          key, "]"));
+  }
+  StringView remapped_key = remap_it->second;
+  if(remapped_key == "{=}" || remapped_key == "=")
+  {
+    return key;
+  }
+
+  if(!isBlackboardPointer(remapped_key))
+  {
+    return nonstd::make_unexpected("setOutput requires a blackboard pointer. Use {}");
+  }
+
+  if(is_any_type)
+  {
+    auto port_type = _p->config.manifest->ports.at(key).type();
+    if(port_type != typeid(BT::Any) && port_type != typeid(BT::AnyTypeAllowed))
+    {
+      throw LogicError("setOutput<Any> is not allowed, unless the port "
+                       "was declared using OutputPort<Any>");
+    }
+  }
+
+  return stripBlackboardPointer(remapped_key);
+}
+
+Expected<TreeNode::ResolvedInputPort>
+TreeNode::resolveInputPort(const std::string& key) const
+{
+  ResolvedInputPort port;
+  const auto& manifest = _p->config.manifest;
+  if(manifest)
+  {
+    auto port_it = manifest->ports.find(key);
+    if(port_it != manifest->ports.end())
+    {
+      port.info = &port_it->second;
+    }
+  }
+
+  auto input_port_it = _p->config.input_ports.find(key);
+  if(input_port_it != _p->config.input_ports.end())
+  {
+    port.value = input_port_it->second;
+    return port;
+  }
+  if(!manifest)
+  {
+    return nonstd::make_unexpected(StrCat("getInput() of node '", fullPath(),
+                                          "' failed because the manifest is "
+                                          "nullptr (WTF?) and the key: [",
+                                          key, "] is missing"));
+  }
+  // maybe it is declared with a default value in the manifest
+  if(port.info == nullptr)
+  {
+    return nonstd::make_unexpected(StrCat("getInput() of node '", fullPath(),
+                                          "' failed because the manifest doesn't "
+                                          "contain the key: [",
+                                          key, "]"));
+  }
+  if(port.info->defaultValue().empty())
+  {
+    return nonstd::make_unexpected(StrCat("getInput() of node '", fullPath(),
+                                          "' failed because nor the manifest or the "
+                                          "XML contain the key: [",
+                                          key, "]"));
+  }
+  if(port.info->defaultValue().isString())
+  {
+    port.value = port.info->defaultValueString();
+  }
+  else
+  {
+    port.default_value = &port.info->defaultValue();
+  }
+  return port;
+}
+
+std::shared_ptr<const linb::any> TreeNode::findLiteralPort(const std::string& key,
+                                                          StringView literal,
+                                                          const std::type_info& type) const
+{
+  const std::scoped_lock lk(_p->literal_ports_mutex);
+  auto it = _p->literal_ports.find(key);
+  if(it == _p->literal_ports.end())
+  {
+    return nullptr;
+  }
+  for(const auto& entry : it->second)
+  {
+    if(entry.value->type() == type && entry.literal == literal)
+    {
+      return entry.value;
+    }
+  }
+  return nullptr;
+}
+
+void TreeNode::cacheLiteralPort(const std::string& key, StringView literal,
+                                linb::any value) const
+{
+  const std::scoped_lock lk(_p->literal_ports_mutex);
+  auto& entries = _p->literal_ports[key];
+  for(const auto& entry : entries)
+  {
+    // the literal was changed at run-time: don't let the cache grow
+    if(entry.value->type() == value.type())
+    {
+      return;
+    }
+  }
+  entries.push_front(
+      { std::string(literal), std::make_shared<const linb::any>(std::move(value)) });
+}
+
 template <>
 std::string toStr<PreCond>(const PreCond& cond)
 {
@@ -502,7 +740,7 @@ AnyPtrLocked BT::TreeNode::getLockedPortContent(const std::string& key)
 {
   if(auto remapped_key = getRemappedKey(key, getRawPortValue(key)))
   {
-    const auto bb_key = std::string(*remapped_key);
+    const StringView bb_key = *remapped_key;
     auto result = _p->config.blackboard->getAnyLocked(bb_key);
     if(!result && _p->config.manifest != nullptr)
     {
@@ -512,7 +750,7 @@ AnyPtrLocked BT::TreeNode::getLockedPortContent(const std::string& key)
       auto port_it = _p->config.manifest->ports.find(key);
       if(port_it != _p->config.manifest->ports.end())
       {
-        _p->config.blackboard->createEntry(bb_key, port_it->second);
+        _p->config.blackboard->createEntry(std::string(bb_key), port_it->second);
         result = _p->config.blackboard->getAnyLocked(bb_key);
       }
     }
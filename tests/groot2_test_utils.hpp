@@ -47,7 +47,7 @@ inline PublisherAndPort makePublisher(const BT::Tree& tree)
 }
 
 /// JSON payload for a HOOK_INSERT request, as Groot2 would send it.
-inline nlohmann::json makeHook(uint16_t uid, BT::Monitor::Hook::Mode mode,
+inline nlohmann::json makeHook(uint32_t uid, BT::Monitor::Hook::Mode mode,
                                BT::Monitor::Hook::Position position, bool once = false)
 {
   return { { "enabled", true },
@@ -0,0 +1,152 @@
+/* Tests checking that the hot paths don't allocate memory.
+ *
+ * They replace the global operator new to count the heap allocations of the
+ * current thread: for this reason they are built as a separate executable
+ * (behaviortree_cpp_alloc_test), instead of being part of behaviortree_cpp_test.
+ */
+
+#include "behaviortree_cpp/bt_factory.h"
+#include "behaviortree_cpp/loggers/bt_observer.h"
+
+#include <cstdlib>
+#include <new>
+
+#include <gtest/gtest.h>
+
+using namespace BT;
+
+namespace
+{
+// heap allocations performed by the current thread
+thread_local size_t allocations_count = 0;
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+  allocations_count++;
+  if(void* ptr = std::malloc(size == 0 ? 1 : size))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+// ============ Blackboard ============
+
+namespace
+{
+// write twice the value of "in_port" into "out_port"
+class DoubleIntNode : public SyncActionNode
+{
+public:
+  DoubleIntNode(const std::string& name, const NodeConfig& config)
+    : SyncActionNode(name, config)
+  {}
+
+  NodeStatus tick() override
+  {
+    auto value = getInput<int>("in_port");
+    if(!value)
+    {
+      throw RuntimeError("DoubleIntNode needs input: ", value.error());
+    }
+    if(!setOutput("out_port", value.value() * 2))
+    {
+      throw RuntimeError("DoubleIntNode failed output");
+    }
+    return NodeStatus::SUCCESS;
+  }
+
+  static PortsList providedPorts()
+  {
+    return { InputPort<int>("in_port"), OutputPort<int>("out_port") };
+  }
+};
+}  // namespace
+
+TEST(AllocationTest, Blackboard_Lookup)
+{
+  // keys longer than the small string optimization of std::string
+  const std::string root_key = "an_input_entry_with_a_long_name";
+  const std::string output_key = "an_output_entry_with_a_long_name";
+  const std::string remapped_key = "remapped_output_entry_with_a_long_name";
+
+  auto root_bb = Blackboard::create();
+  auto bb = Blackboard::create(root_bb);
+  bb->addSubtreeRemapping(output_key, remapped_key);
+  root_bb->set(root_key, 11);
+
+  NodeConfig config;
+  config.blackboard = bb;
+  config.input_ports["in_port"] = "{@" + root_key + "}";
+  config.output_ports["out_port"] = "{" + output_key + "}";
+  DoubleIntNode node("node", config);
+
+  const std::string root_pointer = "@" + root_key;
+  int value = 0;
+  auto access_entries = [&](int i) {
+    node.executeTick();
+    value += bb->get<int>(root_pointer);
+    value += bb->get<int>(output_key);
+    bb->set(output_key, i);
+    value += bb->getStamped<int>(output_key)->value;
+  };
+
+  // first time: create the entries
+  access_entries(0);
+  ASSERT_EQ(root_bb->get<int>(remapped_key), 0);
+
+  const size_t before = allocations_count;
+  for(int i = 1; i < 10; i++)
+  {
+    access_entries(i);
+  }
+  const size_t allocations = allocations_count - before;
+  ASSERT_GT(value, 0);
+  ASSERT_EQ(allocations, 0);
+}
+
+// ============ TreeObserver ============
+
+TEST(AllocationTest, TreeObserver_Tick)
+{
+  BehaviorTreeFactory factory;
+  auto tree = factory.createTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree>
+        <Sequence>
+          <AlwaysSuccess/>
+          <Inverter>
+            <AlwaysFailure/>
+          </Inverter>
+        </Sequence>
+      </BehaviorTree>
+    </root>)");
+  TreeObserver observer(tree);
+  int user_monitor_count = 0;
+  auto subscriber = tree.rootNode()->subscribeToTickMonitor(
+      [&](TreeNode&, NodeStatus, std::chrono::microseconds) { user_monitor_count++; });
+
+  // first time: allocate the histograms of the observer
+  ASSERT_EQ(tree.tickOnce(), NodeStatus::SUCCESS);
+
+  const size_t before = allocations_count;
+  for(int i = 0; i < 10; i++)
+  {
+    tree.tickOnce();
+  }
+  const size_t allocations = allocations_count - before;
+  ASSERT_EQ(user_monitor_count, 11);
+  ASSERT_EQ(observer.getTickDurations(tree.rootNode()->UID()).count, 11);
+  ASSERT_EQ(allocations, 0);
+}
@@ -250,3 +250,53 @@ TEST(Any, Cast)
     EXPECT_EQ(a.cast<std::vector<int>>(), v);
   }
 }
+
+namespace
+{
+struct Point3D
+{
+  double x, y, z;
+};
+
+struct Quaternion
+{
+  double x, y, z, w;
+};
+
+struct Pose3D
+{
+  Point3D position;
+  Quaternion orientation;
+};
+
+template <typename T>
+bool isStoredInline(Any& any)
+{
+  const auto* begin = reinterpret_cast<const char*>(&any);
+  const auto* ptr = reinterpret_cast<const char*>(any.castPtr<T>());
+  return ptr >= begin && ptr < begin + sizeof(Any);
+}
+}  // namespace
+
+TEST(Any, InlineStorage)
+{
+  // A SimpleString always fits into two pointers
+  Any str(std::string("hello"));
+  EXPECT_TRUE(isStoredInline<SafeAny::SimpleString>(str));
+
+  Any point(Point3D{ 1, 2, 3 });
+  EXPECT_EQ(sizeof(Point3D) <= BTCPP_ANY_INLINE_CAPACITY, isStoredInline<Point3D>(point));
+
+  Any quat(Quaternion{ 0, 0, 0, 1 });
+  EXPECT_EQ(sizeof(Quaternion) <= BTCPP_ANY_INLINE_CAPACITY,
+            isStoredInline<Quaternion>(quat));
+
+  Any pose(Pose3D{});
+  EXPECT_EQ(sizeof(Pose3D) <= BTCPP_ANY_INLINE_CAPACITY, isStoredInline<Pose3D>(pose));
+
+  // moving and copying preserve the value, whatever the storage
+  Any moved(std::move(point));
+  EXPECT_EQ(moved.cast<Point3D>().z, 3);
+  Any copied(quat);
+  EXPECT_EQ(copied.cast<Quaternion>().w, 1);
+}
@@ -163,6 +163,44 @@ TEST(BasicTypes, ConvertFromString_Bool)
   ASSERT_THROW((void)convertFromString<bool>("invalid"), RuntimeError);
 }
 
+TEST(BasicTypes, TryConvertFromString)
+{
+  ASSERT_EQ(tryConvertFromString<int>("42").value(), 42);
+  ASSERT_EQ(tryConvertFromString<uint8_t>("255").value(), 255);
+  ASSERT_DOUBLE_EQ(tryConvertFromString<double>("-2.5").value(), -2.5);
+  ASSERT_FLOAT_EQ(tryConvertFromString<float>("0.25").value(), 0.25f);
+  ASSERT_TRUE(tryConvertFromString<bool>("True").value());
+
+  // errors are returned, not thrown
+  auto bad_int = tryConvertFromString<int>("not_a_number");
+  ASSERT_FALSE(bad_int);
+  ASSERT_EQ(bad_int.error(), "Can't convert string [not_a_number] to integer");
+  auto out_of_bound = tryConvertFromString<uint8_t>("256");
+  ASSERT_FALSE(out_of_bound);
+  ASSERT_NE(out_of_bound.error().find("out of bound"), std::string::npos);
+  ASSERT_FALSE(tryConvertFromString<double>(""));
+  ASSERT_FALSE(tryConvertFromString<bool>("yes"));
+
+  ASSERT_EQ(tryConvertFromString<std::vector<int>>("1;-2;3").value(),
+            (std::vector<int>{ 1, -2, 3 }));
+  ASSERT_EQ(tryConvertFromString<std::vector<double>>("0.5;1.5;").value(),
+            (std::vector<double>{ 0.5, 1.5 }));
+  ASSERT_EQ(tryConvertFromString<std::vector<bool>>("true;0").value(),
+            (std::vector<bool>{ true, false }));
+  ASSERT_EQ(tryConvertFromString<std::vector<int>>("json:[4, 5]").value(),
+            (std::vector<int>{ 4, 5 }));
+  ASSERT_TRUE(tryConvertFromString<std::vector<int>>("").value().empty());
+  ASSERT_FALSE(tryConvertFromString<std::vector<int>>("1;two;3"));
+  ASSERT_FALSE(tryConvertFromString<std::vector<int>>("json:[1, 2"));
+
+  // the throwing version reports the same error
+  ASSERT_THROW((void)convertFromString<std::vector<double>>("1;x"), RuntimeError);
+
+  // other types fall back to convertFromString()
+  ASSERT_EQ(tryConvertFromString<NodeStatus>("SUCCESS").value(), NodeStatus::SUCCESS);
+  ASSERT_FALSE(tryConvertFromString<NodeStatus>("WRONG"));
+}
+
 TEST(BasicTypes, ConvertFromString_String)
 {
   ASSERT_EQ(convertFromString<std::string>("hello"), "hello");
@@ -840,3 +840,130 @@ TEST(BlackboardTest, GetLockedPortContentWithDefault_Issue942)
   // The value should be accessible from the blackboard
   ASSERT_EQ(tree.rootBlackboard()->get<int>("value"), 42);
 }
+
+struct CopyCounter
+{
+  static inline int copies = 0;
+  int value = 0;
+
+  CopyCounter(int v = 0) : value(v)
+  {}
+  CopyCounter(const CopyCounter& other) : value(other.value)
+  {
+    copies++;
+  }
+  CopyCounter& operator=(const CopyCounter& other)
+  {
+    value = other.value;
+    copies++;
+    return *this;
+  }
+  CopyCounter(CopyCounter&&) noexcept = default;
+  CopyCounter& operator=(CopyCounter&&) noexcept = default;
+};
+
+TEST(BlackboardTest, SetWithoutCopies)
+{
+  auto bb = Blackboard::create();
+  CopyCounter::copies = 0;
+
+  bb->set("value", CopyCounter(1));
+  ASSERT_EQ(CopyCounter::copies, 0);
+  bb->set("value", CopyCounter(2));
+  ASSERT_EQ(CopyCounter::copies, 0);
+
+  bb->emplace<CopyCounter>("other", 3);
+  ASSERT_EQ(CopyCounter::copies, 0);
+
+  // an lvalue is copied once
+  const CopyCounter lvalue(4);
+  bb->set("value", lvalue);
+  ASSERT_EQ(CopyCounter::copies, 1);
+
+  CopyCounter::copies = 0;
+  ASSERT_EQ(bb->get<CopyCounter>("value").value, 4);
+  ASSERT_EQ(bb->get<CopyCounter>("other").value, 3);
+  ASSERT_EQ(bb->getEntry("value")->sequence_id, 3);
+
+  // the type of the entry can not change
+  ASSERT_THROW(bb->set("value", std::vector<int>{ 1, 2 }), LogicError);
+}
+
+class MoveOutputNode : public SyncActionNode
+{
+public:
+  MoveOutputNode(const std::string& name, const NodeConfig& config)
+    : SyncActionNode(name, config)
+  {}
+
+  NodeStatus tick() override
+  {
+    std::vector<double> path(10000, 1.0);
+    path_data = path.data();
+    return setOutput("path", std::move(path)) ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+  }
+
+  static PortsList providedPorts()
+  {
+    return { BT::OutputPort<std::vector<double>>("path") };
+  }
+
+  const double* path_data = nullptr;
+};
+
+TEST(BlackboardTest, SetOutputMovesValue)
+{
+  std::string xml_txt = R"(
+    <root BTCPP_format="4" >
+      <BehaviorTree ID="Main">
+        <MoveOutputNode path="{path}"/>
+      </BehaviorTree>
+    </root>)";
+
+  BehaviorTreeFactory factory;
+  factory.registerNodeType<MoveOutputNode>("MoveOutputNode");
+  auto tree = factory.createTreeFromText(xml_txt);
+  auto node = dynamic_cast<MoveOutputNode*>(tree.rootNode());
+
+  for(int i = 0; i < 2; i++)
+  {
+    ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+    auto any_ref = tree.rootBlackboard()->getAnyLocked("path");
+    // the buffer allocated by the node is the one in the blackboard
+    ASSERT_EQ(any_ref->castPtr<std::vector<double>>()->data(), node->path_data);
+  }
+}
+
+TEST(BlackboardTest, RemappedEntriesInvalidation)
+{
+  auto root_bb = Blackboard::create();
+  auto mid_bb = Blackboard::create(root_bb);
+  mid_bb->enableAutoRemapping(true);
+  auto leaf_bb = Blackboard::create(mid_bb);
+  leaf_bb->addSubtreeRemapping("leaf_key", "mid_key");
+
+  root_bb->set("mid_key", 1);
+  ASSERT_EQ(leaf_bb->get<int>("leaf_key"), 1);
+  ASSERT_EQ(leaf_bb->get<int>("@mid_key"), 1);
+  ASSERT_EQ(leaf_bb->getEntry("leaf_key"), root_bb->getEntry("mid_key"));
+
+  // writes through the remapped key reach the entry in the root
+  leaf_bb->set("leaf_key", 2);
+  ASSERT_EQ(root_bb->get<int>("mid_key"), 2);
+
+  // the entry found before must not be used, once removed
+  root_bb->unset("mid_key");
+  ASSERT_EQ(leaf_bb->getEntry("leaf_key"), nullptr);
+  ASSERT_EQ(leaf_bb->getEntry("@mid_key"), nullptr);
+
+  root_bb->set("mid_key", 3);
+  ASSERT_EQ(leaf_bb->get<int>("leaf_key"), 3);
+  ASSERT_EQ(leaf_bb->get<int>("@mid_key"), 3);
+
+  // an entry created in the middle hides the one in the root
+  mid_bb->enableAutoRemapping(false);
+  ASSERT_EQ(leaf_bb->getEntry("leaf_key"), nullptr);
+  mid_bb->set("mid_key", 4);
+  ASSERT_EQ(leaf_bb->get<int>("leaf_key"), 4);
+  ASSERT_EQ(leaf_bb->get<int>("@mid_key"), 3);
+}
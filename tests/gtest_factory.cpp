@@ -777,3 +777,48 @@ TEST(BehaviorTreeFactory, MalformedXML_UnknownNodeType)
   BehaviorTreeFactory factory;
   EXPECT_THROW((void)factory.createTreeFromText(xml), RuntimeError);
 }
+
+TEST(BehaviorTreeFactory, NodeByUID)
+{
+  static const char* xml_text = R"(
+<root BTCPP_format="4" main_tree_to_execute="MainTree">
+  <BehaviorTree ID="MainTree">
+    <Sequence>
+      <AlwaysSuccess/>
+      <SubTree ID="Child"/>
+      <SubTree ID="Child"/>
+    </Sequence>
+  </BehaviorTree>
+  <BehaviorTree ID="Child">
+    <Fallback>
+      <AlwaysFailure/>
+      <AlwaysSuccess/>
+    </Fallback>
+  </BehaviorTree>
+</root>)";
+
+  BehaviorTreeFactory factory;
+  auto tree = factory.createTreeFromText(xml_text);
+
+  size_t node_count = 0;
+  for(const auto& subtree : tree.subtrees)
+  {
+    node_count += subtree->nodes.size();
+  }
+  ASSERT_EQ(node_count, 10);
+
+  // UIDs are dense, starting from 1
+  for(uint32_t uid = 1; uid <= node_count; uid++)
+  {
+    auto* node = tree.nodeByUID(uid);
+    ASSERT_NE(node, nullptr);
+    ASSERT_EQ(node->UID(), uid);
+  }
+  ASSERT_EQ(tree.nodeByUID(0), nullptr);
+  ASSERT_EQ(tree.nodeByUID(uint32_t(node_count + 1)), nullptr);
+  ASSERT_EQ(tree.nodeByUID(tree.rootNode()->UID()), tree.rootNode());
+
+  // still valid after the tree is moved
+  Tree moved_tree = std::move(tree);
+  ASSERT_EQ(moved_tree.nodeByUID(1), moved_tree.rootNode());
+}
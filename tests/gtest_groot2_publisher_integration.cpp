@@ -2,8 +2,11 @@
 
 #include <atomic>
 #include <cstdlib>
+#include <limits>
+#include <map>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
 #include <behaviortree_cpp/bt_factory.h>
 #include <gtest/gtest.h>
@@ -126,6 +129,44 @@ std::string requestBlackboardDumpError(const BT::Tree& tree, const std::string&
   }
   return reply[1].to_string();
 }
+
+struct StatusDelta
+{
+  BT::Monitor::StatusDeltaHeader header;
+  std::map<uint16_t, uint8_t> statuses;
+};
+
+StatusDelta requestStatusDelta(Groot2Test::Client& client, uint64_t acknowledged)
+{
+  auto reply = client.request(BT::Monitor::RequestType::STATUS_DELTA,
+                              BT::Monitor::SerializeStatusDeltaRequest(acknowledged));
+  if(reply.size() != 2u)
+  {
+    throw std::runtime_error("Unexpected Groot2 status delta reply size");
+  }
+  const std::string payload = reply[1].to_string();
+  StatusDelta delta;
+  delta.header = BT::Monitor::DeserializeStatusDeltaHeader(payload);
+  for(size_t offset = BT::Monitor::StatusDeltaHeader::size(); offset + 3 <= payload.size();
+      offset += 3)
+  {
+    uint16_t uid = 0;
+    uint8_t status = 0;
+    BT::Monitor::Deserialize(payload.data(), unsigned(offset), uid);
+    BT::Monitor::Deserialize(payload.data(), unsigned(offset + 2), status);
+    delta.statuses[uid] = status;
+  }
+  return delta;
+}
+
+nlohmann::json requestBlackboardDelta(Groot2Test::Client& client,
+                                      const std::string& bb_list, uint64_t acknowledged)
+{
+  auto reply = client.request(
+      BT::Monitor::RequestType::BLACKBOARD_DELTA,
+      BT::Monitor::SerializeBlackboardDeltaRequest(bb_list, acknowledged));
+  return nlohmann::json::from_msgpack(reply[1].to_string());
+}
 }  // namespace
 
 TEST(Groot2PublisherIntegration, PostHookRunsAfterNodeAndCanBeRemoved)
@@ -296,3 +337,314 @@ TEST(Groot2PublisherIntegration, BlackboardDump_RejectsConflictingExternalRoots)
   auto error = requestBlackboardDumpError(tree, "MainTree;ChildB");
   EXPECT_NE(error.find("multiple external root blackboards"), std::string::npos);
 }
+
+TEST(Groot2PublisherIntegration, StatusDelta_SendsOnlyChangedNodes)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = factory.createTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree ID="MainTree">
+        <Fallback>
+          <AlwaysSuccess name="first"/>
+          <AlwaysSuccess name="second"/>
+        </Fallback>
+      </BehaviorTree>
+    </root>)");
+  auto [publisher, port] = Groot2Test::makePublisher(tree);
+  Groot2Test::Client client(port);
+
+  // first request: full snapshot
+  auto snapshot = requestStatusDelta(client, 0);
+  EXPECT_TRUE(snapshot.header.full_snapshot);
+  EXPECT_EQ(snapshot.statuses.size(), 3u);
+
+  // nothing changed
+  auto unchanged = requestStatusDelta(client, snapshot.header.sequence);
+  EXPECT_FALSE(unchanged.header.full_snapshot);
+  EXPECT_TRUE(unchanged.statuses.empty());
+  EXPECT_EQ(unchanged.header.sequence, snapshot.header.sequence);
+
+  // "second" is never ticked, because "first" succeeds
+  tree.tickWhileRunning();
+  uint16_t second_uid = 0;
+  tree.applyVisitor([&](BT::TreeNode* node) {
+    if(node->name() == "second")
+    {
+      second_uid = node->UID();
+    }
+  });
+
+  auto delta = requestStatusDelta(client, snapshot.header.sequence);
+  EXPECT_FALSE(delta.header.full_snapshot);
+  EXPECT_GT(delta.header.sequence, snapshot.header.sequence);
+  EXPECT_EQ(delta.statuses.size(), 2u);
+  EXPECT_EQ(delta.statuses.count(second_uid), 0u);
+  EXPECT_EQ(delta.statuses.at(tree.rootNode()->UID()),
+            uint8_t(10 + static_cast<int>(BT::NodeStatus::SUCCESS)));
+}
+
+TEST(Groot2PublisherIntegration, Status_ProtocolDependsOnLargestUID)
+{
+  BT::BehaviorTreeFactory factory;
+  {
+    auto tree = factory.createTreeFromText(R"(
+      <root BTCPP_format="4">
+        <BehaviorTree ID="MainTree">
+          <AlwaysSuccess/>
+        </BehaviorTree>
+      </root>)");
+    auto [publisher, port] = Groot2Test::makePublisher(tree);
+    Groot2Test::Client client(port);
+    auto reply = client.request(BT::Monitor::RequestType::STATUS);
+    const auto header = BT::Monitor::DeserializeReplyHeader(reply[0].to_string());
+    EXPECT_EQ(header.request.protocol, BT::Monitor::kProtocolID);
+    // 2 bytes for the UID, 1 for the status
+    EXPECT_EQ(reply[1].size(), 3u);
+  }
+  {
+    // a tree with UIDs that don't fit in 16 bits
+    auto subtree = std::make_shared<BT::Tree::Subtree>();
+    subtree->tree_ID = "MainTree";
+    subtree->blackboard = BT::Blackboard::create();
+    BT::NodeConfig config;
+    config.blackboard = subtree->blackboard;
+    config.uid = 70000;
+    config.path = "action";
+    subtree->nodes.push_back(factory.instantiateTreeNode("action", "AlwaysSuccess", config));
+    BT::Tree tree;
+    tree.subtrees.push_back(subtree);
+    tree.initialize();
+    ASSERT_EQ(tree.nodeByUID(70000), tree.rootNode());
+
+    auto [publisher, port] = Groot2Test::makePublisher(tree);
+    Groot2Test::Client client(port);
+    auto reply = client.request(BT::Monitor::RequestType::STATUS);
+    const auto header = BT::Monitor::DeserializeReplyHeader(reply[0].to_string());
+    EXPECT_EQ(header.request.protocol, BT::Monitor::kProtocolIDWideUID);
+    ASSERT_EQ(reply[1].size(), 5u);
+    uint32_t uid = 0;
+    BT::Monitor::Deserialize(static_cast<const char*>(reply[1].data()), 0, uid);
+    EXPECT_EQ(uid, 70000u);
+  }
+}
+
+TEST(Groot2PublisherIntegration, StatusDelta_ResyncWithUnknownSequence)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = factory.createTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree ID="MainTree">
+        <AlwaysSuccess/>
+      </BehaviorTree>
+    </root>)");
+  auto [publisher, port] = Groot2Test::makePublisher(tree);
+  Groot2Test::Client client(port);
+
+  // a sequence number from the future, i.e. from a previous executor
+  auto snapshot = requestStatusDelta(client, 1000000);
+  EXPECT_TRUE(snapshot.header.full_snapshot);
+  EXPECT_EQ(snapshot.statuses.size(), 1u);
+
+  auto error_reply = client.rawRequest(BT::Monitor::RequestType::STATUS_DELTA, "1");
+  ASSERT_EQ(error_reply.size(), 2u);
+  EXPECT_EQ(error_reply[0].to_string(), "error");
+}
+
+TEST(Groot2PublisherIntegration, StatusDelta_ResyncAfterPublisherRestart)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = factory.createTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree ID="MainTree">
+        <Sequence>
+          <AlwaysSuccess/>
+          <AlwaysSuccess/>
+        </Sequence>
+      </BehaviorTree>
+    </root>)");
+  auto [publisher, port] = Groot2Test::makePublisher(tree);
+  Groot2Test::Client client(port);
+
+  // the client is in sync with the first publisher
+  auto state = requestStatusDelta(client, 0);
+  tree.tickWhileRunning();
+  state = requestStatusDelta(client, state.header.sequence);
+  EXPECT_FALSE(state.header.full_snapshot);
+  const uint64_t acknowledged = state.header.sequence;
+
+  // the executor is restarted, on the same port; its tree changes more times
+  // than the ones acknowledged by the client
+  publisher.reset();
+  publisher = std::make_unique<BT::Groot2Publisher>(tree, port);
+  for(int i = 0; i < 5; i++)
+  {
+    tree.haltTree();
+    tree.tickWhileRunning();
+  }
+
+  // the same client, with its stale acknowledgement, must receive everything
+  auto delta = requestStatusDelta(client, acknowledged);
+  EXPECT_TRUE(delta.header.full_snapshot);
+  EXPECT_EQ(delta.statuses.size(), 3u);
+}
+
+TEST(Groot2PublisherIntegration, StatusDelta_ConvergesWhileTreeIsTicking)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = factory.createTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree ID="MainTree">
+        <Sequence>
+          <AlwaysSuccess/>
+          <AlwaysSuccess/>
+          <AlwaysSuccess/>
+        </Sequence>
+      </BehaviorTree>
+    </root>)");
+  auto [publisher, port] = Groot2Test::makePublisher(tree);
+  Groot2Test::Client client(port);
+
+  auto state = requestStatusDelta(client, 0);
+
+  std::atomic_bool keep_ticking = true;
+  std::thread tick_thread([&] {
+    while(keep_ticking.load())
+    {
+      tree.tickExactlyOnce();
+      tree.haltTree();
+    }
+  });
+
+  for(size_t i = 0; i < 50; ++i)
+  {
+    auto delta = requestStatusDelta(client, state.header.sequence);
+    state.header = delta.header;
+    for(const auto& [uid, status] : delta.statuses)
+    {
+      state.statuses[uid] = status;
+    }
+  }
+  keep_ticking = false;
+  tick_thread.join();
+
+  // after applying the last delta, the client must see the same statuses
+  // of a full snapshot
+  auto delta = requestStatusDelta(client, state.header.sequence);
+  for(const auto& [uid, status] : delta.statuses)
+  {
+    state.statuses[uid] = status;
+  }
+  auto snapshot = requestStatusDelta(client, 0);
+  EXPECT_EQ(state.statuses, snapshot.statuses);
+}
+
+TEST(Groot2PublisherIntegration, BlackboardDump_SameValuesOfJsonExport)
+{
+  BT::BehaviorTreeFactory factory;
+  factory.registerBehaviorTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree ID="MainTree">
+        <AlwaysSuccess/>
+      </BehaviorTree>
+    </root>)");
+
+  auto blackboard = BT::Blackboard::create();
+  blackboard->set("negative", -100000);
+  blackboard->set("unsigned", uint64_t(1) << 40);
+  blackboard->set("double", 3.25);
+  blackboard->set("flag", true);
+  blackboard->set("text", std::string("hello world, this string is longer than 32 bytes"));
+  blackboard->set("doubles", std::vector<double>{ 1.5, -2.5 });
+  blackboard->set("strings", std::vector<std::string>{ "a", "b" });
+  blackboard->set("empty_ints", std::vector<int>{});
+  blackboard->createEntry("not_set", BT::PortInfo(BT::PortDirection::INOUT));
+  auto tree = factory.createTree("MainTree", blackboard);
+
+  auto json = requestBlackboardDump(tree, "MainTree");
+  EXPECT_EQ(json["MainTree"], BT::ExportBlackboardToJSON(*blackboard));
+}
+
+TEST(Groot2PublisherIntegration, BlackboardDelta_OnlyChangedEntries)
+{
+  BT::BehaviorTreeFactory factory;
+  factory.registerBehaviorTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree ID="MainTree">
+        <AlwaysSuccess/>
+      </BehaviorTree>
+    </root>)");
+
+  auto blackboard = BT::Blackboard::create();
+  blackboard->set("first", 1);
+  blackboard->set("second", std::string("two"));
+  auto tree = factory.createTree("MainTree", blackboard);
+  auto [publisher, port] = Groot2Test::makePublisher(tree);
+  Groot2Test::Client client(port);
+
+  auto json = requestBlackboardDelta(client, "MainTree", 0);
+  ASSERT_EQ(json["MainTree"].size(), 2u);
+  EXPECT_EQ(json["MainTree"]["first"].get<int>(), 1);
+  EXPECT_EQ(json["MainTree"]["second"].get<std::string>(), "two");
+  ASSERT_EQ(json[BT::Monitor::kCompleteBlackboardsKey].size(), 1u);
+  auto sequence = json[BT::Monitor::kSequenceKey].get<uint64_t>();
+
+  // nothing changed
+  json = requestBlackboardDelta(client, "MainTree", sequence);
+  EXPECT_TRUE(json["MainTree"].empty());
+  EXPECT_TRUE(json[BT::Monitor::kCompleteBlackboardsKey].empty());
+  sequence = json[BT::Monitor::kSequenceKey].get<uint64_t>();
+
+  blackboard->set("first", 42);
+  json = requestBlackboardDelta(client, "MainTree", sequence);
+  ASSERT_EQ(json["MainTree"].size(), 1u);
+  EXPECT_EQ(json["MainTree"]["first"].get<int>(), 42);
+  EXPECT_TRUE(json[BT::Monitor::kCompleteBlackboardsKey].empty());
+  sequence = json[BT::Monitor::kSequenceKey].get<uint64_t>();
+
+  // when entries are added or removed, the blackboard is sent again entirely
+  blackboard->set("third", 3.0);
+  blackboard->unset("second");
+  json = requestBlackboardDelta(client, "MainTree", sequence);
+  ASSERT_EQ(json["MainTree"].size(), 2u);
+  EXPECT_EQ(json["MainTree"]["first"].get<int>(), 42);
+  EXPECT_EQ(json["MainTree"]["third"].get<double>(), 3.0);
+  ASSERT_EQ(json[BT::Monitor::kCompleteBlackboardsKey].size(), 1u);
+  EXPECT_EQ(json[BT::Monitor::kCompleteBlackboardsKey][0].get<std::string>(), "MainTree");
+
+  // an unknown sequence sends everything again
+  json = requestBlackboardDelta(client, "MainTree", std::numeric_limits<uint64_t>::max());
+  EXPECT_EQ(json["MainTree"].size(), 2u);
+  EXPECT_EQ(json[BT::Monitor::kCompleteBlackboardsKey].size(), 1u);
+}
+
+TEST(Groot2PublisherIntegration, BlackboardDelta_ClientsAreIndependent)
+{
+  BT::BehaviorTreeFactory factory;
+  factory.registerBehaviorTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree ID="MainTree">
+        <AlwaysSuccess/>
+      </BehaviorTree>
+    </root>)");
+
+  auto blackboard = BT::Blackboard::create();
+  blackboard->set("value", 1);
+  auto tree = factory.createTree("MainTree", blackboard);
+  auto [publisher, port] = Groot2Test::makePublisher(tree);
+  Groot2Test::Client client_a(port);
+  Groot2Test::Client client_b(port);
+
+  auto json_a = requestBlackboardDelta(client_a, "MainTree", 0);
+  auto json_b = requestBlackboardDelta(client_b, "MainTree", 0);
+  const auto sequence_a = json_a[BT::Monitor::kSequenceKey].get<uint64_t>();
+  const auto sequence_b = json_b[BT::Monitor::kSequenceKey].get<uint64_t>();
+
+  blackboard->set("value", 2);
+  // the first client receiving the change doesn't consume it
+  json_a = requestBlackboardDelta(client_a, "MainTree", sequence_a);
+  json_b = requestBlackboardDelta(client_b, "MainTree", sequence_b);
+  ASSERT_EQ(json_a["MainTree"].size(), 1u);
+  ASSERT_EQ(json_b["MainTree"].size(), 1u);
+  EXPECT_EQ(json_a["MainTree"]["value"].get<int>(), 2);
+  EXPECT_EQ(json_b["MainTree"]["value"].get<int>(), 2);
+}
@@ -100,6 +100,34 @@ TEST(Groot2PublisherThreadSafety, DestroyWhileStatusCallbacksAreRunning)
   tick_thread.join();
 }
 
+TEST(Groot2PublisherThreadSafety, RequestStatusWhileTreeIsTicking)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = factory.createTreeFromText(kTreeXml);
+  auto [publisher, port] = Groot2Test::makePublisher(tree);
+  Groot2Test::Client client(port);
+
+  // callback() writes the status without locking, while the server thread
+  // reads it to build STATUS and STATUS_DELTA replies.
+  std::atomic_bool keep_ticking = true;
+  std::thread tick_thread([&] {
+    while(keep_ticking.load())
+    {
+      tree.tickExactlyOnce();
+    }
+  });
+
+  for(size_t i = 0; i < 100; ++i)
+  {
+    client.request(BT::Monitor::RequestType::STATUS);
+    client.request(BT::Monitor::RequestType::STATUS_DELTA,
+                   BT::Monitor::SerializeStatusDeltaRequest(i));
+  }
+
+  keep_ticking = false;
+  tick_thread.join();
+}
+
 // TSan's lock-order detector reports an inversion in the old implementation:
 // disabling took hooks_map_mutex -> hook->mutex, while one-shot removal took
 // hook->mutex -> hooks_map_mutex.
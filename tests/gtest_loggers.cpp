@@ -11,14 +11,21 @@
 */
 
 #include "behaviortree_cpp/bt_factory.h"
+#include "behaviortree_cpp/contrib/json.hpp"
 #include "behaviortree_cpp/loggers/bt_cout_logger.h"
 #include "behaviortree_cpp/loggers/bt_file_logger_v2.h"
 #include "behaviortree_cpp/loggers/bt_minitrace_logger.h"
+#include "behaviortree_cpp/loggers/bt_observer.h"
+#include "behaviortree_cpp/loggers/bt_sampling_profiler.h"
 #include "behaviortree_cpp/loggers/bt_sqlite_logger.h"
 
+#include <atomic>
+#include <chrono>
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -401,6 +408,47 @@ TEST_F(LoggerTest, SqliteLogger_MultipleTicks)
   ASSERT_TRUE(std::filesystem::exists(filepath));
 }
 
+TEST_F(LoggerTest, SqliteLogger_ConcurrentParallel)
+{
+  const std::string xml_text = R"(
+    <root BTCPP_format="4">
+       <BehaviorTree>
+          <ConcurrentParallel success_count="-1" failure_count="1">
+            <Rendezvous/>
+            <Rendezvous/>
+          </ConcurrentParallel>
+       </BehaviorTree>
+    </root>)";
+
+  // the children complete at the same time, in different threads
+  std::atomic_int arrived = 0;
+  factory.registerSimpleCondition("Rendezvous", [&](TreeNode&) {
+    arrived++;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while(arrived < 2 && std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::yield();
+    }
+    return NodeStatus::SUCCESS;
+  });
+
+  auto tree = factory.createTreeFromText(xml_text);
+  std::string filepath = test_dir + "/concurrent.db3";
+
+  // the timestamp is the primary key of the Transitions table: if two
+  // concurrent callbacks used the same timestamp, the writer thread would throw
+  {
+    SqliteLogger logger(tree, filepath);
+    for(int i = 0; i < 200; i++)
+    {
+      arrived = 0;
+      ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+    }
+  }
+
+  ASSERT_TRUE(std::filesystem::exists(filepath));
+}
+
 // ============ Multiple loggers simultaneously ============
 
 TEST_F(LoggerTest, MultipleLoggers)
@@ -456,6 +504,234 @@ TEST_F(LoggerTest, LoggerWithAsyncTree)
   ASSERT_TRUE(std::filesystem::exists(filepath));
 }
 
+// ============ TreeObserver ============
+
+TEST_F(LoggerTest, TreeObserver_TickDurations)
+{
+  factory.registerSimpleAction("SlowAction", [](TreeNode&) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    return NodeStatus::SUCCESS;
+  });
+
+  const std::string xml_text = R"(
+    <root BTCPP_format="4">
+       <BehaviorTree>
+          <Sequence>
+            <SlowAction name="slow"/>
+            <AlwaysSuccess name="fast"/>
+          </Sequence>
+       </BehaviorTree>
+    </root>)";
+
+  auto tree = factory.createTreeFromText(xml_text);
+  TreeObserver observer(tree);
+
+  for(int i = 0; i < 5; i++)
+  {
+    tree.tickWhileRunning();
+  }
+
+  const auto slow = observer.getTickDurations("slow");
+  ASSERT_EQ(slow.count, 5);
+  ASSERT_GE(slow.p50, std::chrono::milliseconds(2));
+  ASSERT_GE(slow.p99, slow.p50);
+  ASSERT_GE(slow.max, slow.p99);
+  ASSERT_GE(slow.mean, std::chrono::milliseconds(2));
+
+  const auto fast = observer.getTickDurations("fast");
+  ASSERT_EQ(fast.count, 5);
+  ASSERT_LT(fast.p50, slow.p50);
+
+  ASSERT_EQ(observer.tickDurations().size(), 3);
+  ASSERT_EQ(observer.getStatistics("slow").success_count, 5);
+
+  ASSERT_THROW(observer.getTickDurations("missing"), RuntimeError);
+  ASSERT_THROW(observer.getTickDurations(uint16_t(1000)), RuntimeError);
+}
+
+TEST_F(LoggerTest, TreeObserver_ResetWhileTicking)
+{
+  auto tree = createSimpleTree();
+  auto observer = std::make_unique<TreeObserver>(tree);
+
+  std::atomic_bool stop = false;
+  std::thread ticker([&]() {
+    while(!stop)
+    {
+      tree.tickWhileRunning();
+    }
+  });
+
+  for(int i = 0; i < 100; i++)
+  {
+    const auto stats = observer->getStatistics("ActionA");
+    const auto durations = observer->getTickDurations("ActionA");
+    ASSERT_LE(durations.p50, durations.max);
+    ASSERT_LE(stats.success_count, stats.transitions_count);
+    observer->resetStatistics();
+  }
+  stop = true;
+  ticker.join();
+
+  observer->resetStatistics();
+  ASSERT_EQ(observer->getStatistics("ActionA").transitions_count, 0);
+  ASSERT_EQ(observer->getTickDurations("ActionA").count, 0);
+
+  tree.tickWhileRunning();
+  ASSERT_EQ(observer->getStatistics("ActionA").success_count, 1);
+  ASSERT_EQ(observer->getTickDurations("ActionA").count, 1);
+
+  // the tick monitor must be removed together with the observer
+  observer.reset();
+  tree.tickWhileRunning();
+}
+
+TEST_F(LoggerTest, TreeObserver_KeepsOtherTickMonitors)
+{
+  auto tree = createSimpleTree();
+  auto root = tree.rootNode();
+  int user_monitor_count = 0;
+  root->setTickMonitorCallback(
+      [&](TreeNode&, NodeStatus, std::chrono::microseconds) { user_monitor_count++; });
+
+  auto first = std::make_unique<TreeObserver>(tree);
+  TreeObserver second(tree);
+  tree.tickWhileRunning();
+  ASSERT_EQ(user_monitor_count, 1);
+  ASSERT_EQ(first->getTickDurations("ActionA").count, 1);
+  ASSERT_EQ(second.getTickDurations("ActionA").count, 1);
+
+  // destroying an observer doesn't remove the other monitors
+  first.reset();
+  tree.tickWhileRunning();
+  ASSERT_EQ(user_monitor_count, 2);
+  ASSERT_EQ(second.getTickDurations("ActionA").count, 2);
+}
+
+TEST(DurationHistogram, LargeValuesAreClamped)
+{
+  using details::DurationHistogram;
+  DurationHistogram histogram;
+
+  histogram.record(std::numeric_limits<uint32_t>::max());
+  histogram.record(uint64_t(1) << 31);
+  histogram.record(std::numeric_limits<uint64_t>::max());
+
+  const auto stats = histogram.snapshot();
+  ASSERT_EQ(stats.count, 3);
+  ASSERT_EQ(stats.max.count(), DurationHistogram::kMaxValue);
+  ASSERT_EQ(stats.p99.count(), DurationHistogram::kMaxValue);
+  ASSERT_GE(stats.p50.count(), uint64_t(1) << 31);
+  ASSERT_LE(stats.p50, stats.max);
+}
+
+// ============ SamplingProfiler ============
+
+TEST_F(LoggerTest, SamplingProfiler_ManualSamples)
+{
+  const std::string xml_text = R"(
+    <root BTCPP_format="4">
+       <BehaviorTree>
+          <Sequence name="main">
+            <AlwaysSuccess/>
+            <Sleep msec="500" name="wait"/>
+          </Sequence>
+       </BehaviorTree>
+    </root>)";
+
+  auto tree = factory.createTreeFromText(xml_text);
+  SamplingProfiler profiler(tree, std::chrono::microseconds(0));
+
+  // nothing is RUNNING yet
+  profiler.sample();
+  ASSERT_EQ(profiler.foldedStacks(), "");
+
+  ASSERT_EQ(tree.tickOnce(), NodeStatus::RUNNING);
+  for(int i = 0; i < 3; i++)
+  {
+    profiler.sample();
+  }
+  tree.haltTree();
+  profiler.sample();
+
+  ASSERT_EQ(profiler.samplesCount(), 5);
+  ASSERT_EQ(profiler.foldedStacks(), "Sequence::main;Sleep::wait 3\n");
+
+  const auto trace = nlohmann::json::parse(profiler.chromeTrace());
+  const auto& events = trace["traceEvents"];
+  ASSERT_EQ(events.size(), 2);
+  for(const auto& event : events)
+  {
+    ASSERT_EQ(event["ph"], "X");
+    ASSERT_GE(event["dur"].get<int64_t>(), 0);
+  }
+
+  profiler.reset();
+  ASSERT_EQ(profiler.samplesCount(), 0);
+  ASSERT_EQ(profiler.foldedStacks(), "");
+}
+
+TEST_F(LoggerTest, SamplingProfiler_TraceKeepsNewestEvents)
+{
+  const std::string xml_text = R"(
+    <root BTCPP_format="4">
+       <BehaviorTree>
+          <Sequence name="main">
+            <Sleep msec="500" name="wait"/>
+          </Sequence>
+       </BehaviorTree>
+    </root>)";
+
+  auto tree = factory.createTreeFromText(xml_text);
+  SamplingProfiler profiler(tree, std::chrono::microseconds(0), 2);
+
+  // each iteration creates an event for the Sequence and one for the Sleep
+  for(int i = 0; i < 3; i++)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ASSERT_EQ(tree.tickOnce(), NodeStatus::RUNNING);
+    profiler.sample();
+    tree.haltTree();
+    profiler.sample();
+  }
+  ASSERT_EQ(profiler.droppedTraceEvents(), 4);
+  ASSERT_EQ(profiler.foldedStacks(), "Sequence::main;Sleep::wait 3\n");
+
+  const auto trace = nlohmann::json::parse(profiler.chromeTrace());
+  const auto& events = trace["traceEvents"];
+  ASSERT_EQ(events.size(), 2);
+  for(const auto& event : events)
+  {
+    ASSERT_GE(event["ts"].get<int64_t>(), 3000);
+  }
+
+  profiler.reset();
+  ASSERT_EQ(profiler.droppedTraceEvents(), 0);
+}
+
+TEST_F(LoggerTest, SamplingProfiler_BackgroundThread)
+{
+  const std::string xml_text = R"(
+    <root BTCPP_format="4">
+       <BehaviorTree>
+          <Sequence>
+            <Sleep msec="20" name="first"/>
+            <Sleep msec="20" name="second"/>
+          </Sequence>
+       </BehaviorTree>
+    </root>)";
+
+  auto tree = factory.createTreeFromText(xml_text);
+  SamplingProfiler profiler(tree, std::chrono::milliseconds(1));
+  tree.tickWhileRunning(std::chrono::milliseconds(1));
+  profiler.stop();
+
+  ASSERT_GT(profiler.samplesCount(), 0);
+  const std::string folded = profiler.foldedStacks();
+  ASSERT_NE(folded.find("Sequence;Sleep::first "), std::string::npos);
+  ASSERT_NE(folded.find("Sequence;Sleep::second "), std::string::npos);
+}
+
 // ============ Edge cases ============
 
 TEST_F(LoggerTest, Logger_EmptyTree)
@@ -15,6 +15,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 using namespace BT;
 
 // ============ LoopNode with static queue (string parsed) ============
@@ -484,3 +486,169 @@ TEST(LoopNode, ConvertFromString_String)
   EXPECT_EQ(queue->at(1), "bar");
   EXPECT_EQ(queue->at(2), "baz");
 }
+
+// ============ LoopNode batch mode ============
+
+TEST(LoopNode, BatchMode)
+{
+  BehaviorTreeFactory factory;
+
+  std::vector<std::vector<int>> received_batches;
+  PortsList ports = { InputPort<SharedBatch<int>>("batch") };
+  factory.registerSimpleAction(
+      "RecordBatch",
+      [&received_batches](TreeNode& node) {
+        auto batch = node.getInput<SharedBatch<int>>("batch");
+        if(batch && batch.value())
+        {
+          received_batches.push_back(*batch.value());
+        }
+        return NodeStatus::SUCCESS;
+      },
+      ports);
+
+  const std::string xml_text = R"(
+    <root BTCPP_format="4">
+       <BehaviorTree>
+          <LoopInt queue="1;2;3;4;5" batch_size="2" batch="{batch}">
+            <RecordBatch batch="{batch}"/>
+          </LoopInt>
+       </BehaviorTree>
+    </root>)";
+
+  auto tree = factory.createTreeFromText(xml_text);
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+
+  const std::vector<std::vector<int>> expected = { { 1, 2 }, { 3, 4 }, { 5 } };
+  EXPECT_EQ(received_batches, expected);
+}
+
+// ============ LoopNode with MPSCQueue ============
+
+TEST(LoopNode, MPSCQueueFromBlackboard)
+{
+  BehaviorTreeFactory factory;
+
+  std::vector<int> received_values;
+  PortsList ports = { InputPort<int>("value") };
+  factory.registerSimpleAction(
+      "RecordIntValue",
+      [&received_values](TreeNode& node) {
+        received_values.push_back(node.getInput<int>("value").value());
+        return NodeStatus::SUCCESS;
+      },
+      ports);
+
+  const std::string xml_text = R"(
+    <root BTCPP_format="4">
+       <BehaviorTree>
+          <LoopInt queue="{queue}" value="{val}">
+            <RecordIntValue value="{val}"/>
+          </LoopInt>
+       </BehaviorTree>
+    </root>)";
+
+  auto tree = factory.createTreeFromText(xml_text);
+  auto queue = std::make_shared<MPSCQueue<int>>();
+  tree.rootBlackboard()->set("queue", queue);
+
+  queue->push(1);
+  queue->push(2);
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+  queue->push(3);
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+
+  EXPECT_EQ(received_values, std::vector<int>({ 1, 2, 3 }));
+  EXPECT_TRUE(queue->empty());
+}
+
+TEST(LoopNode, MPSCQueueConcurrentProducers)
+{
+  constexpr int kProducers = 4;
+  constexpr int kItems = 10000;
+  MPSCQueue<std::pair<int, int>> queue;
+
+  std::vector<std::thread> producers;
+  for(int p = 0; p < kProducers; p++)
+  {
+    producers.emplace_back([&queue, p]() {
+      for(int i = 0; i < kItems; i++)
+      {
+        queue.push({ p, i });
+      }
+    });
+  }
+
+  // each producer must be received in order
+  std::vector<int> next_item(kProducers, 0);
+  int received = 0;
+  while(received < kProducers * kItems)
+  {
+    if(auto item = queue.tryPop())
+    {
+      EXPECT_EQ(item->second, next_item[item->first]);
+      next_item[item->first]++;
+      received++;
+    }
+  }
+  for(auto& producer : producers)
+  {
+    producer.join();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+// ============ LoopNode with a type that is not default-constructible ============
+
+namespace
+{
+struct Waypoint
+{
+  explicit Waypoint(int waypoint_id) : id(waypoint_id)
+  {}
+  int id;
+};
+}  // namespace
+
+TEST(LoopNode, NotDefaultConstructibleType)
+{
+  BehaviorTreeFactory factory;
+  factory.registerNodeType<LoopNode<Waypoint>>("LoopWaypoint");
+
+  std::vector<int> received_ids;
+  PortsList ports = { InputPort<Waypoint>("value") };
+  factory.registerSimpleAction(
+      "RecordWaypoint",
+      [&received_ids](TreeNode& node) {
+        auto any_ref = node.getLockedPortContent("value");
+        received_ids.push_back(any_ref.get()->cast<Waypoint>().id);
+        return NodeStatus::SUCCESS;
+      },
+      ports);
+
+  const std::string xml_text = R"(
+    <root BTCPP_format="4">
+       <BehaviorTree>
+          <Sequence>
+            <LoopWaypoint queue="{queue}" value="{waypoint}">
+              <RecordWaypoint value="{waypoint}"/>
+            </LoopWaypoint>
+            <LoopWaypoint queue="{mpsc_queue}" value="{waypoint}">
+              <RecordWaypoint value="{waypoint}"/>
+            </LoopWaypoint>
+          </Sequence>
+       </BehaviorTree>
+    </root>)";
+
+  auto tree = factory.createTreeFromText(xml_text);
+  auto queue = std::make_shared<std::deque<Waypoint>>();
+  queue->emplace_back(1);
+  queue->emplace_back(2);
+  auto mpsc_queue = std::make_shared<MPSCQueue<Waypoint>>();
+  mpsc_queue->push(Waypoint(3));
+  tree.rootBlackboard()->set("queue", queue);
+  tree.rootBlackboard()->set("mpsc_queue", mpsc_queue);
+
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+  EXPECT_EQ(received_ids, std::vector<int>({ 1, 2, 3 }));
+}
@@ -20,6 +20,11 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+
 using BT::NodeStatus;
 using std::chrono::milliseconds;
 
@@ -702,3 +707,111 @@ TEST(Parallel, Issue819_SequenceVsReactiveSequence)
     ASSERT_EQ(2, tick_counts[1]);  // Re-evaluated!
   }
 }
+
+TEST(Parallel, ConcurrentParallel_ChildrenTickedConcurrently)
+{
+  using namespace BT;
+
+  static const char* xml_text = R"(
+<root BTCPP_format="4">
+  <BehaviorTree ID="MainTree">
+    <ConcurrentParallel success_count="-1" failure_count="1">
+      <Rendezvous/>
+      <Rendezvous/>
+    </ConcurrentParallel>
+  </BehaviorTree>
+</root>
+)";
+
+  // each child returns SUCCESS only if the other ones are being ticked
+  // at the same time: this can not happen if they are ticked in sequence
+  std::atomic_int arrived = 0;
+  std::mutex threads_mutex;
+  std::set<std::thread::id> threads;
+
+  BehaviorTreeFactory factory;
+  factory.registerSimpleCondition("Rendezvous", [&](TreeNode&) {
+    {
+      std::scoped_lock lk(threads_mutex);
+      threads.insert(std::this_thread::get_id());
+    }
+    arrived++;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while(arrived < 2 && std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::yield();
+    }
+    return arrived >= 2 ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+  });
+
+  auto tree = factory.createTreeFromText(xml_text);
+  ASSERT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning());
+  ASSERT_EQ(threads.size(), 2u);
+  ASSERT_EQ(threads.count(std::this_thread::get_id()), 1u);
+}
+
+TEST(Parallel, ConcurrentParallel_Thresholds)
+{
+  static const char* xml_text = R"(
+<root BTCPP_format="4">
+  <BehaviorTree ID="MainTree">
+    <ConcurrentParallel name="parallel" success_count="1" failure_count="3">
+      <GoodTest name="first"/>
+      <BadTest name="second"/>
+      <SlowTest name="third"/>
+    </ConcurrentParallel>
+  </BehaviorTree>
+</root>  )";
+  using namespace BT;
+
+  BehaviorTreeFactory factory;
+
+  BT::TestNodeConfig good_config;
+  good_config.async_delay = std::chrono::milliseconds(200);
+  good_config.return_status = NodeStatus::SUCCESS;
+  factory.registerNodeType<BT::TestNode>("GoodTest", good_config);
+
+  BT::TestNodeConfig bad_config;
+  bad_config.async_delay = std::chrono::milliseconds(100);
+  bad_config.return_status = NodeStatus::FAILURE;
+  factory.registerNodeType<BT::TestNode>("BadTest", bad_config);
+
+  BT::TestNodeConfig slow_config;
+  slow_config.async_delay = std::chrono::milliseconds(300);
+  slow_config.return_status = NodeStatus::SUCCESS;
+  factory.registerNodeType<BT::TestNode>("SlowTest", slow_config);
+
+  auto tree = factory.createTreeFromText(xml_text);
+  BT::TreeObserver observer(tree);
+
+  auto state = tree.tickWhileRunning();
+  ASSERT_EQ(NodeStatus::SUCCESS, state);
+  ASSERT_EQ(1, observer.getStatistics("first").success_count);
+  ASSERT_EQ(1, observer.getStatistics("second").failure_count);
+  // halted when "first" succeeded
+  ASSERT_EQ(0, observer.getStatistics("third").success_count);
+  ASSERT_EQ(NodeStatus::IDLE, observer.getStatistics("third").current_status);
+}
+
+TEST(Parallel, ConcurrentParallel_ExceptionRethrown)
+{
+  static const char* xml_text = R"(
+<root BTCPP_format="4">
+  <BehaviorTree ID="MainTree">
+    <ConcurrentParallel>
+      <AlwaysSuccess/>
+      <Throwing/>
+      <AlwaysSuccess/>
+    </ConcurrentParallel>
+  </BehaviorTree>
+</root>  )";
+  using namespace BT;
+
+  BehaviorTreeFactory factory;
+  factory.registerSimpleAction("Throwing", [](TreeNode&) -> NodeStatus {
+    throw RuntimeError("thrown by a child");
+  });
+  auto tree = factory.createTreeFromText(xml_text);
+  ASSERT_THROW(tree.tickWhileRunning(), BT::RuntimeError);
+}
+
@@ -887,3 +887,379 @@ TEST(PortTest, IsBlackboardPointerAllWhitespaceView)
   EXPECT_EQ(stripped, "key");
   EXPECT_FALSE(TreeNode::isBlackboardPointer("value"));
 }
+
+struct CountedConversion
+{
+  int value = 0;
+  static inline int conversions = 0;
+};
+
+template <>
+[[nodiscard]] CountedConversion BT::convertFromString<CountedConversion>(StringView str)
+{
+  CountedConversion::conversions++;
+  return { convertFromString<int>(str) };
+}
+
+class ReadCountedConversion : public SyncActionNode
+{
+public:
+  ReadCountedConversion(const std::string& name, const NodeConfig& config,
+                        std::vector<int>* values)
+    : SyncActionNode(name, config), values_(values)
+  {}
+
+  NodeStatus tick() override
+  {
+    values_->push_back(getInput<CountedConversion>("in").value().value);
+    return NodeStatus::SUCCESS;
+  }
+
+  static PortsList providedPorts()
+  {
+    return { BT::InputPort<CountedConversion>("in") };
+  }
+
+private:
+  std::vector<int>* values_;
+};
+
+TEST(PortTest, LiteralInputConvertedOnce)
+{
+  std::string xml_txt = R"(
+    <root BTCPP_format="4" >
+      <BehaviorTree ID="MainTree">
+        <Sequence>
+          <Repeat num_cycles="5">
+            <ReadCounted in="42"/>
+          </Repeat>
+          <Repeat num_cycles="3">
+            <ReadCounted in="{value}"/>
+          </Repeat>
+        </Sequence>
+      </BehaviorTree>
+    </root>)";
+
+  std::vector<int> values;
+  BehaviorTreeFactory factory;
+  factory.registerNodeType<ReadCountedConversion>("ReadCounted", &values);
+  auto tree = factory.createTreeFromText(xml_txt);
+  tree.rootBlackboard()->set("value", std::string("7"));
+
+  CountedConversion::conversions = 0;
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+
+  // the literal is converted only by the first tick
+  ASSERT_EQ(CountedConversion::conversions, 1);
+  ASSERT_EQ(values, std::vector<int>({ 42, 42, 42, 42, 42, 7, 7, 7 }));
+}
+
+class RemappedLiteralNode : public SyncActionNode
+{
+public:
+  RemappedLiteralNode(const std::string& name, const NodeConfig& config)
+    : SyncActionNode(name, config)
+  {}
+
+  NodeStatus tick() override
+  {
+    return NodeStatus::SUCCESS;
+  }
+
+  static PortsList providedPorts()
+  {
+    return { BT::InputPort<std::vector<int>>("in") };
+  }
+
+  void remap(const PortsRemapping& remapping)
+  {
+    modifyPortsRemapping(remapping);
+  }
+};
+
+TEST(PortTest, LiteralInputCacheClearedByRemapping)
+{
+  std::string xml_txt = R"(
+    <root BTCPP_format="4" >
+      <BehaviorTree ID="MainTree">
+        <RemappedLiteral in="1;2;3"/>
+      </BehaviorTree>
+    </root>)";
+
+  BehaviorTreeFactory factory;
+  factory.registerNodeType<RemappedLiteralNode>("RemappedLiteral");
+  auto tree = factory.createTreeFromText(xml_txt);
+  auto* node = dynamic_cast<RemappedLiteralNode*>(tree.rootNode());
+  ASSERT_NE(node, nullptr);
+
+  auto shared = node->getInputShared<std::vector<int>>("in");
+  ASSERT_TRUE(shared);
+  ASSERT_EQ(node->getInput<std::vector<int>>("in").value(), std::vector<int>({ 1, 2, 3 }));
+
+  // the values read before the remapping remain valid
+  node->remap({ { "in", "4;5" } });
+  ASSERT_EQ(*shared.value(), std::vector<int>({ 1, 2, 3 }));
+  ASSERT_EQ(node->getInput<std::vector<int>>("in").value(), std::vector<int>({ 4, 5 }));
+  ASSERT_EQ(*node->getInputShared<std::vector<int>>("in").value(), std::vector<int>({ 4, 5 }));
+}
+
+TEST(PortTest, StringEntryConvertedOncePerWrite)
+{
+  std::string xml_txt = R"(
+    <root BTCPP_format="4" >
+      <BehaviorTree ID="MainTree">
+        <Sequence>
+          <Repeat num_cycles="3">
+            <ReadCounted in="{value}"/>
+          </Repeat>
+          <Script code="value:='8'" />
+          <Repeat num_cycles="3">
+            <ReadCounted in="{value}"/>
+          </Repeat>
+        </Sequence>
+      </BehaviorTree>
+    </root>)";
+
+  std::vector<int> values;
+  BehaviorTreeFactory factory;
+  factory.registerNodeType<ReadCountedConversion>("ReadCounted", &values);
+  // the entry is created as a string, before the tree
+  auto blackboard = Blackboard::create();
+  blackboard->set("value", std::string("7"));
+  auto tree = factory.createTreeFromText(xml_txt, blackboard);
+
+  CountedConversion::conversions = 0;
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+
+  // the string is parsed again only after it was modified
+  ASSERT_EQ(CountedConversion::conversions, 2);
+  ASSERT_EQ(values, std::vector<int>({ 7, 7, 7, 8, 8, 8 }));
+
+  // modifications through getAnyLocked() invalidate the converted values too
+  if(auto any_locked = blackboard->getAnyLocked("value"))
+  {
+    any_locked.assign(std::string("9"));
+  }
+  ASSERT_EQ(blackboard->get<int>("value"), 9);
+  values.clear();
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+  ASSERT_EQ(values, std::vector<int>({ 9, 9, 9, 8, 8, 8 }));
+}
+
+// same type of ReadCountedConversion, but with a custom StringConverter
+class ReadScaledConversion : public SyncActionNode
+{
+public:
+  ReadScaledConversion(const std::string& name, const NodeConfig& config,
+                       std::vector<int>* values)
+    : SyncActionNode(name, config), values_(values)
+  {}
+
+  NodeStatus tick() override
+  {
+    values_->push_back(getInput<CountedConversion>("in").value().value);
+    auto handle = bindInput<CountedConversion>("in");
+    values_->push_back(handle.get().value().value);
+    return NodeStatus::SUCCESS;
+  }
+
+  static PortsList providedPorts()
+  {
+    return { { "in", PortInfo(PortDirection::INPUT, typeid(CountedConversion),
+                              [](StringView str) {
+                                return Any(CountedConversion{
+                                    10 * convertFromString<int>(str) });
+                              }) } };
+  }
+
+private:
+  std::vector<int>* values_;
+};
+
+TEST(PortTest, StringEntryConvertedPerConverter)
+{
+  std::string xml_txt = R"(
+    <root BTCPP_format="4" >
+      <BehaviorTree ID="MainTree">
+        <Sequence>
+          <ReadCounted in="{value}"/>
+          <ReadScaled in="{value}"/>
+          <ReadCounted in="{value}"/>
+          <ReadScaled in="{value}"/>
+        </Sequence>
+      </BehaviorTree>
+    </root>)";
+
+  std::vector<int> values;
+  BehaviorTreeFactory factory;
+  factory.registerNodeType<ReadCountedConversion>("ReadCounted", &values);
+  factory.registerNodeType<ReadScaledConversion>("ReadScaled", &values);
+  auto blackboard = Blackboard::create();
+  blackboard->set("value", std::string("7"));
+  auto tree = factory.createTreeFromText(xml_txt, blackboard);
+
+  // the values memoized with a converter are not returned to the other one
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+  ASSERT_EQ(values, std::vector<int>({ 7, 70, 70, 7, 70, 70 }));
+}
+
+class NodeWithPortHandles : public SyncActionNode
+{
+public:
+  NodeWithPortHandles(const std::string& name, const NodeConfig& config)
+    : SyncActionNode(name, config)
+    , literal_(bindInput<int>("literal"))
+    , with_default_(bindInput<Point2D>("with_default"))
+    , from_blackboard_(bindInput<double>("from_blackboard"))
+    , missing_(bindInput<int>("missing"))
+  {}
+
+  NodeStatus tick() override
+  {
+    EXPECT_EQ(literal_.get().value(), getInput<int>("literal").value());
+    EXPECT_EQ(with_default_.get().value(), getInput<Point2D>("with_default").value());
+    EXPECT_FALSE(missing_.get());
+
+    auto stamped = from_blackboard_.getStamped();
+    if(!stamped)
+    {
+      return NodeStatus::FAILURE;
+    }
+    EXPECT_EQ(stamped->stamp.seq, getInputStamped<double>("from_blackboard")->stamp.seq);
+    values.push_back(stamped->value);
+    return NodeStatus::SUCCESS;
+  }
+
+  static PortsList providedPorts()
+  {
+    return { BT::InputPort<int>("literal"),
+             BT::InputPort<Point2D>("with_default", Point2D{ 1, 2 }, "default"),
+             BT::InputPort<double>("from_blackboard"), BT::InputPort<int>("missing") };
+  }
+
+  std::vector<double> values;
+
+private:
+  InputPortHandle<int> literal_;
+  InputPortHandle<Point2D> with_default_;
+  InputPortHandle<double> from_blackboard_;
+  InputPortHandle<int> missing_;
+};
+
+TEST(PortTest, InputPortHandle)
+{
+  std::string xml_txt = R"(
+    <root BTCPP_format="4" >
+      <BehaviorTree>
+        <NodeWithPortHandles literal="42" from_blackboard="{value}"/>
+      </BehaviorTree>
+    </root>)";
+
+  BehaviorTreeFactory factory;
+  factory.registerNodeType<NodeWithPortHandles>("NodeWithPortHandles");
+  auto tree = factory.createTreeFromText(xml_txt);
+  auto node = dynamic_cast<NodeWithPortHandles*>(tree.rootNode());
+
+  // the entry does not exist yet
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::FAILURE);
+
+  tree.rootBlackboard()->set("value", 1.5);
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+  tree.rootBlackboard()->set("value", 2.5);
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+
+  // a new entry must be resolved again
+  tree.rootBlackboard()->unset("value");
+  tree.rootBlackboard()->set("value", std::string("3.5"));
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+
+  ASSERT_EQ(node->values, std::vector<double>({ 1.5, 2.5, 3.5 }));
+
+  // a default-constructed handle is not bound
+  ASSERT_FALSE(InputPortHandle<int>().get());
+}
+
+class NodeWithSharedInput : public SyncActionNode
+{
+public:
+  NodeWithSharedInput(const std::string& name, const NodeConfig& config)
+    : SyncActionNode(name, config)
+  {}
+
+  NodeStatus tick() override
+  {
+    auto path = getInputShared<std::vector<double>>("path");
+    auto weights = getInputShared<std::vector<int>>("weights");
+    if(!path || !weights)
+    {
+      return NodeStatus::FAILURE;
+    }
+    paths.push_back(path.value());
+    weights_list.push_back(weights.value());
+    return NodeStatus::SUCCESS;
+  }
+
+  static PortsList providedPorts()
+  {
+    return { BT::InputPort<std::vector<double>>("path"),
+             BT::InputPort<std::vector<int>>("weights") };
+  }
+
+  std::vector<std::shared_ptr<const std::vector<double>>> paths;
+  std::vector<std::shared_ptr<const std::vector<int>>> weights_list;
+};
+
+TEST(PortTest, GetInputShared)
+{
+  std::string xml_txt = R"(
+    <root BTCPP_format="4" >
+      <BehaviorTree>
+        <NodeWithSharedInput path="{path}" weights="1;2;3"/>
+      </BehaviorTree>
+    </root>)";
+
+  BehaviorTreeFactory factory;
+  factory.registerNodeType<NodeWithSharedInput>("NodeWithSharedInput");
+  auto tree = factory.createTreeFromText(xml_txt);
+  auto node = dynamic_cast<NodeWithSharedInput*>(tree.rootNode());
+
+  const std::vector<double> first_path(1000, 1.0);
+  tree.rootBlackboard()->set("path", first_path);
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+
+  tree.rootBlackboard()->set("path", std::vector<double>(10, 2.0));
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+
+  ASSERT_EQ(node->paths.size(), 3u);
+  // no copy if the value didn't change
+  ASSERT_EQ(node->paths[0].get(), node->paths[1].get());
+  // the old snapshot is not modified by the writer
+  ASSERT_NE(node->paths[1].get(), node->paths[2].get());
+  ASSERT_EQ(*node->paths[0], first_path);
+  ASSERT_EQ(*node->paths[2], std::vector<double>(10, 2.0));
+
+  // literals are converted and shared once
+  ASSERT_EQ(*node->weights_list[0], std::vector<int>({ 1, 2, 3 }));
+  ASSERT_EQ(node->weights_list[0].get(), node->weights_list[2].get());
+
+  // access through the Blackboard, shared with the node
+  auto from_blackboard = tree.rootBlackboard()->getShared<std::vector<double>>("path");
+  ASSERT_EQ(from_blackboard.get(), node->paths[2].get());
+
+  // reading the entry with get() doesn't discard the snapshot
+  ASSERT_EQ(tree.rootBlackboard()->get<std::vector<double>>("path").size(), 10u);
+  ASSERT_EQ(tree.tickWhileRunning(), NodeStatus::SUCCESS);
+  ASSERT_EQ(node->paths[3].get(), node->paths[2].get());
+
+  // a locked pointer may modify the value: the snapshot must be discarded
+  if(auto any_ref = tree.rootBlackboard()->getAnyLocked("path"))
+  {
+    any_ref->castPtr<std::vector<double>>()->push_back(3.0);
+  }
+  auto modified = tree.rootBlackboard()->getShared<std::vector<double>>("path");
+  ASSERT_EQ(modified->size(), 11u);
+  ASSERT_EQ(node->paths[2]->size(), 10u);
+
+  ASSERT_THROW((void)tree.rootBlackboard()->getShared<double>("missing"), RuntimeError);
+}
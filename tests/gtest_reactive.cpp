@@ -418,3 +418,108 @@ TEST(Reactive, ReactiveSequence_ReEvaluatesOnEveryTick)
   // Condition should be ticked multiple times (re-evaluated while Sleep is running)
   ASSERT_GE(condition_tick_count, 2);
 }
+
+namespace
+{
+void RegisterIncrementalTestNodes(BT::BehaviorTreeFactory& factory, int& positive_ticks,
+                                  int& no_inputs_ticks)
+{
+  factory.registerSimpleCondition(
+      "IsPositive",
+      [&positive_ticks](BT::TreeNode& node) {
+        positive_ticks++;
+        return (node.getInput<int>("value").value() > 0) ? NodeStatus::SUCCESS :
+                                                           NodeStatus::FAILURE;
+      },
+      { BT::InputPort<int>("value") });
+
+  factory.registerSimpleCondition("NoInputs", [&no_inputs_ticks](BT::TreeNode&) {
+    no_inputs_ticks++;
+    return NodeStatus::SUCCESS;
+  });
+}
+}  // namespace
+
+TEST(Reactive, ReactiveSequence_Incremental)
+{
+  BT::BehaviorTreeFactory factory;
+  int positive_ticks = 0;
+  int no_inputs_ticks = 0;
+  RegisterIncrementalTestNodes(factory, positive_ticks, no_inputs_ticks);
+
+  static const char* xml_text = R"(
+<root BTCPP_format="4">
+  <BehaviorTree>
+    <ReactiveSequence incremental="true">
+      <IsPositive value="{value}"/>
+      <NoInputs/>
+      <KeepRunningUntilFailure>
+        <AlwaysSuccess/>
+      </KeepRunningUntilFailure>
+    </ReactiveSequence>
+  </BehaviorTree>
+</root>
+)";
+
+  auto blackboard = BT::Blackboard::create();
+  blackboard->set("value", 1);
+  auto tree = factory.createTreeFromText(xml_text, blackboard);
+
+  for(int i = 0; i < 3; i++)
+  {
+    ASSERT_EQ(tree.tickOnce(), NodeStatus::RUNNING);
+  }
+  // the input of IsPositive didn't change; NoInputs is always ticked
+  ASSERT_EQ(positive_ticks, 1);
+  ASSERT_EQ(no_inputs_ticks, 3);
+
+  blackboard->set("value", 2);
+  ASSERT_EQ(tree.tickOnce(), NodeStatus::RUNNING);
+  ASSERT_EQ(positive_ticks, 2);
+
+  blackboard->set("value", -1);
+  ASSERT_EQ(tree.tickOnce(), NodeStatus::FAILURE);
+  ASSERT_EQ(positive_ticks, 3);
+
+  // the FAILURE is reused, too
+  ASSERT_EQ(tree.tickOnce(), NodeStatus::FAILURE);
+  ASSERT_EQ(positive_ticks, 3);
+  ASSERT_EQ(no_inputs_ticks, 4);
+}
+
+TEST(Reactive, ReactiveFallback_Incremental)
+{
+  BT::BehaviorTreeFactory factory;
+  int positive_ticks = 0;
+  int no_inputs_ticks = 0;
+  RegisterIncrementalTestNodes(factory, positive_ticks, no_inputs_ticks);
+
+  static const char* xml_text = R"(
+<root BTCPP_format="4">
+  <BehaviorTree>
+    <ReactiveFallback incremental="true">
+      <IsPositive value="{value}"/>
+      <KeepRunningUntilFailure>
+        <AlwaysSuccess/>
+      </KeepRunningUntilFailure>
+    </ReactiveFallback>
+  </BehaviorTree>
+</root>
+)";
+
+  auto blackboard = BT::Blackboard::create();
+  blackboard->set("value", -1);
+  auto tree = factory.createTreeFromText(xml_text, blackboard);
+
+  for(int i = 0; i < 3; i++)
+  {
+    ASSERT_EQ(tree.tickOnce(), NodeStatus::RUNNING);
+  }
+  ASSERT_EQ(positive_ticks, 1);
+
+  // an entry removed and created again is an update
+  blackboard->unset("value");
+  blackboard->set("value", 1);
+  ASSERT_EQ(tree.tickOnce(), NodeStatus::SUCCESS);
+  ASSERT_EQ(positive_ticks, 2);
+}
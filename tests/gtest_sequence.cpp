@@ -18,6 +18,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 using BT::NodeStatus;
 using std::chrono::milliseconds;
 
@@ -458,3 +460,53 @@ TEST(SequenceWithMemoryTest, Issue_636)
 
   ASSERT_EQ(5, tick_count);
 }
+
+TEST(SequenceTest, HaltResetsChildrenNotIdle)
+{
+  BT::SequenceNode root("root_sequence");
+  BT::SyncActionTest first("first");
+  BT::AsyncActionTest action("action", milliseconds(500));
+  BT::SyncActionTest last("last");
+  root.addChild(&first);
+  root.addChild(&action);
+  root.addChild(&last);
+
+  ASSERT_EQ(NodeStatus::RUNNING, root.executeTick());
+  ASSERT_EQ(NodeStatus::SUCCESS, first.status());
+  ASSERT_EQ(NodeStatus::RUNNING, action.status());
+  ASSERT_EQ(NodeStatus::IDLE, last.status());
+
+  // the completed and the RUNNING children are reset, the IDLE one is skipped
+  root.haltNode();
+  ASSERT_EQ(NodeStatus::IDLE, root.status());
+  ASSERT_EQ(NodeStatus::IDLE, first.status());
+  ASSERT_EQ(NodeStatus::IDLE, action.status());
+  ASSERT_EQ(NodeStatus::IDLE, last.status());
+  ASSERT_EQ(0, action.successCount());
+  ASSERT_EQ(0, last.tickCount());
+
+  // the status of the async child is changed by its own thread:
+  // haltChild() must see that it completed and reset it
+  action.setTime(milliseconds(10));
+  ASSERT_EQ(NodeStatus::RUNNING, root.executeTick());
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while(action.status() == NodeStatus::RUNNING &&
+        std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(milliseconds(1));
+  }
+  ASSERT_EQ(NodeStatus::SUCCESS, action.status());
+  root.haltChild(1);
+  ASSERT_EQ(NodeStatus::IDLE, action.status());
+  root.haltChild(2);
+  ASSERT_EQ(NodeStatus::IDLE, last.status());
+
+  // ticking the sequence again restarts the child
+  action.setTime(milliseconds(500));
+  ASSERT_EQ(NodeStatus::RUNNING, root.executeTick());
+  ASSERT_EQ(NodeStatus::RUNNING, action.status());
+  root.haltNode();
+  ASSERT_EQ(NodeStatus::IDLE, action.status());
+  ASSERT_EQ(1, action.successCount());
+  ASSERT_EQ(0, last.tickCount());
+}
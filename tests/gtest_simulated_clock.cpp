@@ -0,0 +1,108 @@
+#include "test_helper.hpp"
+
+#include "behaviortree_cpp/bt_factory.h"
+#include "behaviortree_cpp/utils/clock.h"
+#include "behaviortree_cpp/utils/timer_queue.h"
+
+#include <gtest/gtest.h>
+
+using namespace BT;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+TEST(SimulatedClock, AdvanceExecutesTimers)
+{
+  auto clock = std::make_shared<SimulatedClock>();
+  TimerQueue<> timer;
+  timer.setClock(clock);
+
+  std::vector<int> fired;
+  timer.add(milliseconds(200), [&fired](bool aborted) {
+    if(!aborted)
+    {
+      fired.push_back(200);
+    }
+  });
+  timer.add(milliseconds(100), [&fired](bool aborted) {
+    if(!aborted)
+    {
+      fired.push_back(100);
+    }
+  });
+
+  clock->advance(milliseconds(50));
+  EXPECT_TRUE(fired.empty());
+  clock->advance(milliseconds(100));
+  EXPECT_EQ(fired, std::vector<int>({ 100 }));
+  clock->advance(seconds(1));
+  EXPECT_EQ(fired, std::vector<int>({ 100, 200 }));
+  EXPECT_EQ(clock->now(), TimePoint(milliseconds(1150)));
+}
+
+TEST(SimulatedClock, SleepNode)
+{
+  BehaviorTreeFactory factory;
+  auto tree = CreateTreeFromBody(factory, R"(<Sleep msec="10000"/>)");
+  auto clock = std::make_shared<SimulatedClock>();
+  tree.setClock(clock);
+
+  TimePoint success_time;
+  auto subscriber = tree.rootNode()->subscribeToStatusChange(
+      [&](TimePoint timestamp, const TreeNode&, NodeStatus, NodeStatus status) {
+        if(status == NodeStatus::SUCCESS)
+        {
+          success_time = timestamp;
+        }
+      });
+
+  // much faster than 10 seconds, in real time
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning());
+  EXPECT_LT(std::chrono::steady_clock::now() - start, seconds(5));
+
+  EXPECT_EQ(clock->now(), TimePoint(seconds(10)));
+  EXPECT_EQ(success_time, TimePoint(seconds(10)));
+}
+
+TEST(SimulatedClock, TimeoutAndDelay)
+{
+  BehaviorTreeFactory factory;
+  auto clock = std::make_shared<SimulatedClock>();
+
+  auto timeout_tree = CreateTreeFromBody(factory, R"(
+    <Timeout msec="1000">
+      <Sleep msec="5000"/>
+    </Timeout>)");
+  timeout_tree.setClock(clock);
+  EXPECT_EQ(NodeStatus::FAILURE, timeout_tree.tickWhileRunning(milliseconds(300)));
+  EXPECT_EQ(clock->now(), TimePoint(milliseconds(1000)));
+
+  auto delay_tree = CreateTreeFromBody(factory, R"(
+    <Delay delay_msec="2000">
+      <AlwaysSuccess/>
+    </Delay>)");
+  delay_tree.setClock(clock);
+  EXPECT_EQ(NodeStatus::SUCCESS, delay_tree.tickWhileRunning(milliseconds(300)));
+  EXPECT_EQ(clock->now(), TimePoint(milliseconds(3000)));
+}
+
+TEST(SimulatedClock, TickWhileRunningWithoutSleep)
+{
+  BehaviorTreeFactory factory;
+  auto tree = CreateTreeFromBody(factory, R"(
+    <Sequence>
+      <Sleep msec="2000"/>
+      <Delay delay_msec="3000">
+        <AlwaysSuccess/>
+      </Delay>
+    </Sequence>)");
+  auto clock = std::make_shared<SimulatedClock>();
+  tree.setClock(clock);
+
+  EXPECT_EQ(NodeStatus::RUNNING, tree.tickOnce());
+  EXPECT_EQ(clock->now(), TimePoint());
+
+  // the time jumps from one timer to the next one
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning(milliseconds(0)));
+  EXPECT_EQ(clock->now(), TimePoint(milliseconds(5000)));
+}
@@ -264,3 +264,134 @@ TEST(SwitchStringEquality, RejectsTrailingCharacters)
   EXPECT_FALSE(CheckStringEquality("5 ", "5", nullptr));
   EXPECT_FALSE(CheckStringEquality("none", "1", nullptr));
 }
+
+TEST(SwitchCases, LiteralAndBlackboardCases)
+{
+  static const char* xml = R"(
+<root BTCPP_format="4" >
+  <BehaviorTree ID="MainTree">
+    <Switch4 variable="{my_var}" case_1="1.0" case_2="FAILURE" case_3="{dynamic_case}"
+             case_4="text">
+      <Script code=" result:=1 "/>
+      <Script code=" result:=2 "/>
+      <Script code=" result:=3 "/>
+      <Script code=" result:=4 "/>
+      <Script code=" result:=0 "/>
+    </Switch4>
+  </BehaviorTree>
+</root>)";
+
+  BT::BehaviorTreeFactory factory;
+  factory.registerScriptingEnums<BT::NodeStatus>();
+  auto tree = factory.createTreeFromText(xml);
+  auto bb = tree.rootBlackboard();
+
+  auto TickWith = [&](const std::string& value) {
+    bb->set("my_var", value);
+    EXPECT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning());
+    return bb->get<int>("result");
+  };
+
+  bb->set("dynamic_case", std::string("first"));
+  EXPECT_EQ(1, TickWith("1"));
+  EXPECT_EQ(2, TickWith("3"));  // value of the enum FAILURE
+  EXPECT_EQ(2, TickWith("FAILURE"));
+  EXPECT_EQ(3, TickWith("first"));
+  EXPECT_EQ(4, TickWith("text"));
+  EXPECT_EQ(0, TickWith("second"));
+
+  // the cases remapped to the blackboard are read at every tick
+  bb->set("dynamic_case", std::string("second"));
+  EXPECT_EQ(3, TickWith("second"));
+  EXPECT_EQ(0, TickWith("first"));
+}
+
+TEST(Dispatch, SelectsBranchByValue)
+{
+  static const char* xml = R"(
+<root BTCPP_format="4" >
+  <BehaviorTree ID="MainTree">
+    <Dispatch variable="{mode}" cases="explore; dock ;7;FAILURE">
+      <Script code=" result:=1 "/>
+      <Script code=" result:=2 "/>
+      <Script code=" result:=3 "/>
+      <Script code=" result:=4 "/>
+      <Script code=" result:=0 "/>
+    </Dispatch>
+  </BehaviorTree>
+</root>)";
+
+  BT::BehaviorTreeFactory factory;
+  factory.registerScriptingEnums<BT::NodeStatus>();
+  auto tree = factory.createTreeFromText(xml);
+  auto bb = tree.rootBlackboard();
+
+  auto TickWith = [&](const std::string& value) {
+    bb->set("mode", value);
+    EXPECT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning());
+    return bb->get<int>("result");
+  };
+
+  EXPECT_EQ(1, TickWith("explore"));
+  EXPECT_EQ(2, TickWith("dock"));
+  EXPECT_EQ(3, TickWith("7"));
+  EXPECT_EQ(4, TickWith("FAILURE"));
+  EXPECT_EQ(4, TickWith("3"));  // value of the enum FAILURE
+  EXPECT_EQ(0, TickWith("charge"));
+  EXPECT_EQ(0, TickWith("7.0"));
+}
+
+TEST(Dispatch, HaltsPreviousBranch)
+{
+  static const char* xml = R"(
+<root BTCPP_format="4" >
+  <BehaviorTree ID="MainTree">
+    <Dispatch variable="{mode}" cases="A;B">
+      <AsyncActionTest name="action_A"/>
+      <AsyncActionTest name="action_B"/>
+      <AsyncActionTest name="action_default"/>
+    </Dispatch>
+  </BehaviorTree>
+</root>)";
+
+  BT::BehaviorTreeFactory factory;
+  factory.registerNodeType<BT::AsyncActionTest>("AsyncActionTest");
+  auto tree = factory.createTreeFromText(xml);
+  auto bb = tree.rootBlackboard();
+
+  auto* action_A = dynamic_cast<BT::AsyncActionTest*>(tree.subtrees[0]->nodes[1].get());
+  auto* action_B = dynamic_cast<BT::AsyncActionTest*>(tree.subtrees[0]->nodes[2].get());
+  ASSERT_NE(action_A, nullptr);
+  ASSERT_NE(action_B, nullptr);
+
+  bb->set("mode", std::string("A"));
+  ASSERT_EQ(NodeStatus::RUNNING, tree.tickOnce());
+  ASSERT_EQ(NodeStatus::RUNNING, action_A->status());
+
+  bb->set("mode", std::string("B"));
+  ASSERT_EQ(NodeStatus::RUNNING, tree.tickOnce());
+  ASSERT_EQ(NodeStatus::IDLE, action_A->status());
+  ASSERT_EQ(NodeStatus::RUNNING, action_B->status());
+  tree.haltTree();
+}
+
+TEST(Dispatch, InvalidCases)
+{
+  BT::BehaviorTreeFactory factory;
+  auto CreateAndTick = [&](const std::string& dispatch) {
+    auto tree = factory.createTreeFromText(
+        R"(<root BTCPP_format="4"><BehaviorTree ID="MainTree">)" + dispatch +
+        "<AlwaysSuccess/><AlwaysSuccess/><AlwaysSuccess/>"
+        "</Dispatch></BehaviorTree></root>");
+    tree.tickOnce();
+  };
+  EXPECT_NO_THROW(CreateAndTick(R"(<Dispatch variable="{v}" cases="A;B">)"));
+  // duplicated case
+  EXPECT_THROW(CreateAndTick(R"(<Dispatch variable="{v}" cases="A;A">)"), BT::RuntimeError);
+  EXPECT_THROW(CreateAndTick(R"(<Dispatch variable="{v}" cases="1;01">)"), BT::RuntimeError);
+  // wrong number of children
+  EXPECT_THROW(CreateAndTick(R"(<Dispatch variable="{v}" cases="A;B;C">)"), BT::RuntimeError);
+  // not a literal
+  EXPECT_THROW(CreateAndTick(R"(<Dispatch variable="{v}" cases="{cases}">)"),
+               BT::RuntimeError);
+}
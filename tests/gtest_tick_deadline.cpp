@@ -0,0 +1,140 @@
+#include "behaviortree_cpp/bt_factory.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+
+using namespace BT;
+using std::chrono::steady_clock;
+
+namespace
+{
+// A deadline that is already expired: each tick of a Sequence or Fallback
+// executes a single child, which records an overrun.
+steady_clock::time_point Expired()
+{
+  return steady_clock::now();
+}
+
+void RegisterCounters(BehaviorTreeFactory& factory, std::array<int, 3>& counters,
+                      NodeStatus result)
+{
+  for(size_t i = 0; i < counters.size(); i++)
+  {
+    factory.registerSimpleAction("Action" + std::to_string(i),
+                                 [&counters, i, result](TreeNode&) {
+                                   counters[i]++;
+                                   return result;
+                                 });
+  }
+}
+
+}  // namespace
+
+TEST(TickDeadline, SequenceResumesFromNextChild)
+{
+  BehaviorTreeFactory factory;
+  std::array<int, 3> counters = { 0, 0, 0 };
+  RegisterCounters(factory, counters, NodeStatus::SUCCESS);
+
+  auto tree = factory.createTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree ID="MainTree">
+        <Sequence>
+          <Action0/>
+          <Action1/>
+          <Action2/>
+        </Sequence>
+      </BehaviorTree>
+    </root>)");
+
+  EXPECT_EQ(NodeStatus::RUNNING, tree.tickOnceUntil(Expired()));
+  EXPECT_EQ(counters, (std::array<int, 3>{ 1, 0, 0 }));
+  EXPECT_EQ(NodeStatus::RUNNING, tree.tickOnceUntil(Expired()));
+  EXPECT_EQ(counters, (std::array<int, 3>{ 1, 1, 0 }));
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickOnceUntil(Expired()));
+  EXPECT_EQ(counters, (std::array<int, 3>{ 1, 1, 1 }));
+
+  // every action exceeded the deadline once
+  const auto overruns = tree.deadlineOverruns();
+  for(const auto& node : tree.subtrees[0]->nodes)
+  {
+    const uint64_t expected = (node->type() == NodeType::ACTION) ? 1 : 0;
+    const uint64_t count = node->UID() < overruns.size() ? overruns[node->UID()] : 0;
+    EXPECT_EQ(expected, count) << node->name();
+  }
+
+  // without a deadline, all the children are ticked at once
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickOnce());
+  EXPECT_EQ(counters, (std::array<int, 3>{ 2, 2, 2 }));
+
+  // a deadline in the future is not reached
+  const auto future = steady_clock::now() + std::chrono::seconds(10);
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickOnceUntil(future));
+  EXPECT_EQ(counters, (std::array<int, 3>{ 3, 3, 3 }));
+}
+
+TEST(TickDeadline, NestedFallback)
+{
+  BehaviorTreeFactory factory;
+  std::array<int, 3> counters = { 0, 0, 0 };
+  RegisterCounters(factory, counters, NodeStatus::FAILURE);
+
+  auto tree = factory.createTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree ID="MainTree">
+        <Fallback>
+          <Fallback>
+            <Action0/>
+            <Action1/>
+          </Fallback>
+          <Action2/>
+        </Fallback>
+      </BehaviorTree>
+    </root>)");
+
+  EXPECT_EQ(NodeStatus::RUNNING, tree.tickOnceUntil(Expired()));
+  EXPECT_EQ(counters, (std::array<int, 3>{ 1, 0, 0 }));
+  // the inner Fallback completes and the outer one yields
+  EXPECT_EQ(NodeStatus::RUNNING, tree.tickOnceUntil(Expired()));
+  EXPECT_EQ(counters, (std::array<int, 3>{ 1, 1, 0 }));
+  EXPECT_EQ(NodeStatus::FAILURE, tree.tickOnceUntil(Expired()));
+  EXPECT_EQ(counters, (std::array<int, 3>{ 1, 1, 1 }));
+}
+
+TEST(TickDeadline, ConcurrentParallelOverruns)
+{
+  BehaviorTreeFactory factory;
+  factory.registerSimpleAction("Slow", [](TreeNode&) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return NodeStatus::SUCCESS;
+  });
+
+  // the children complete in the worker threads, after the deadline
+  auto tree = factory.createTreeFromText(R"(
+    <root BTCPP_format="4">
+      <BehaviorTree ID="MainTree">
+        <ConcurrentParallel success_count="-1">
+          <Slow/>
+          <Slow/>
+          <Slow/>
+          <Slow/>
+        </ConcurrentParallel>
+      </BehaviorTree>
+    </root>)");
+
+  const int ticks = 20;
+  for(int i = 0; i < ticks; i++)
+  {
+    EXPECT_EQ(NodeStatus::SUCCESS, tree.tickOnceUntil(Expired()));
+  }
+
+  // a single overrun for each tick
+  uint64_t total = 0;
+  for(const auto count : tree.deadlineOverruns())
+  {
+    total += count;
+  }
+  EXPECT_EQ(total, uint64_t(ticks));
+}
@@ -0,0 +1,171 @@
+#include "test_helper.hpp"
+
+#include "behaviortree_cpp/bt_factory.h"
+#include "behaviortree_cpp/controls/utility_selector_node.h"
+
+#include <gtest/gtest.h>
+
+using BT::NodeStatus;
+
+namespace
+{
+BT::UtilitySelectorNode* GetSelector(BT::Tree& tree)
+{
+  return dynamic_cast<BT::UtilitySelectorNode*>(tree.rootNode());
+}
+
+}  // namespace
+
+TEST(UtilitySelector, TicksBestChild)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateTreeFromBody(factory, R"(
+    <UtilitySelector scores="a; b * 2; 3;">
+      <Script code=" result:=1 "/>
+      <Script code=" result:=2 "/>
+      <Script code=" result:=3 "/>
+    </UtilitySelector>)");
+  auto bb = tree.rootBlackboard();
+  bb->set("a", 10);
+  bb->set("b", 1.0);
+
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning());
+  EXPECT_EQ(1, bb->get<int>("result"));
+
+  bb->set("b", 6.0);
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning());
+  EXPECT_EQ(2, bb->get<int>("result"));
+
+  // equal scores: the first child wins
+  bb->set("a", 1);
+  bb->set("b", 1.5);
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning());
+  EXPECT_EQ(2, bb->get<int>("result"));
+  const std::vector<double> expected = { 1.0, 3.0, 3.0 };
+  EXPECT_EQ(expected, GetSelector(tree)->scores());
+}
+
+TEST(UtilitySelector, ScoresCachedUntilUpdated)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateTreeFromBody(factory, R"(
+    <UtilitySelector scores="a + 1; b">
+      <AlwaysSuccess/>
+      <AlwaysSuccess/>
+    </UtilitySelector>)");
+  auto bb = tree.rootBlackboard();
+  bb->set("a", 1);
+  bb->set("b", 1);
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickOnce());
+  EXPECT_EQ(std::vector<double>({ 2.0, 1.0 }), GetSelector(tree)->scores());
+
+  // modifying the value in place does not update the entry:
+  // the score is not evaluated again
+  bb->getAnyLocked("a").assign(BT::Any(5));
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickOnce());
+  EXPECT_EQ(std::vector<double>({ 2.0, 1.0 }), GetSelector(tree)->scores());
+
+  bb->set("a", 7);
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickOnce());
+  EXPECT_EQ(std::vector<double>({ 8.0, 1.0 }), GetSelector(tree)->scores());
+}
+
+TEST(UtilitySelector, FailureTicksNextBest)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateTreeFromBody(factory, R"(
+    <UtilitySelector scores="1; 10; 5">
+      <Script code=" result:=1 "/>
+      <AlwaysFailure/>
+      <Script code=" result:=3 "/>
+    </UtilitySelector>)");
+  auto bb = tree.rootBlackboard();
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning());
+  EXPECT_EQ(3, bb->get<int>("result"));
+
+  auto all_fail = CreateTreeFromBody(factory, R"(
+    <UtilitySelector scores="1; 2">
+      <AlwaysFailure/>
+      <AlwaysFailure/>
+    </UtilitySelector>)");
+  EXPECT_EQ(NodeStatus::FAILURE, all_fail.tickWhileRunning());
+}
+
+TEST(UtilitySelector, Hysteresis)
+{
+  BT::BehaviorTreeFactory factory;
+  factory.registerNodeType<KeepRunningAction>("KeepRunning");
+  auto tree = CreateTreeFromBody(factory, R"(
+    <UtilitySelector scores="a; b" hysteresis="1.0">
+      <KeepRunning/>
+      <KeepRunning/>
+    </UtilitySelector>)");
+  auto bb = tree.rootBlackboard();
+  auto* first = tree.subtrees[0]->nodes[1].get();
+  auto* second = tree.subtrees[0]->nodes[2].get();
+
+  bb->set("a", 2.0);
+  bb->set("b", 1.0);
+  ASSERT_EQ(NodeStatus::RUNNING, tree.tickOnce());
+  ASSERT_EQ(NodeStatus::RUNNING, first->status());
+
+  // higher, but not enough to halt the running child
+  bb->set("b", 2.5);
+  ASSERT_EQ(NodeStatus::RUNNING, tree.tickOnce());
+  ASSERT_EQ(NodeStatus::RUNNING, first->status());
+  ASSERT_EQ(NodeStatus::IDLE, second->status());
+
+  bb->set("b", 3.5);
+  ASSERT_EQ(NodeStatus::RUNNING, tree.tickOnce());
+  ASSERT_EQ(NodeStatus::IDLE, first->status());
+  ASSERT_EQ(NodeStatus::RUNNING, second->status());
+  tree.haltTree();
+}
+
+TEST(UtilitySelector, InvalidScores)
+{
+  BT::BehaviorTreeFactory factory;
+  auto CreateAndTick = [&](const std::string& selector) {
+    auto tree = CreateTreeFromBody(factory, selector +
+                                                "<AlwaysSuccess/><AlwaysSuccess/>"
+                                                "</UtilitySelector>");
+    tree.tickOnce();
+  };
+  EXPECT_NO_THROW(CreateAndTick(R"(<UtilitySelector scores="1; 2">)"));
+  // assignments are not allowed
+  EXPECT_THROW(CreateAndTick(R"(<UtilitySelector scores="a:=1; 2">)"),
+               BT::RuntimeError);
+  // empty score
+  EXPECT_THROW(CreateAndTick(R"(<UtilitySelector scores="1;;2">)"),
+               BT::RuntimeError);
+  // wrong number of children
+  EXPECT_THROW(CreateAndTick(R"(<UtilitySelector scores="1; 2; 3">)"),
+               BT::RuntimeError);
+  // missing blackboard entry
+  EXPECT_THROW(CreateAndTick(R"(<UtilitySelector scores="{scores}">)"),
+               BT::RuntimeError);
+}
+
+TEST(UtilitySelector, ScoresFromBlackboardEntry)
+{
+  BT::BehaviorTreeFactory factory;
+  auto tree = CreateTreeFromBody(factory, R"(
+    <UtilitySelector scores="{utilities}">
+      <Script code=" result:=1 "/>
+      <Script code=" result:=2 "/>
+    </UtilitySelector>)");
+  auto bb = tree.rootBlackboard();
+
+  bb->set("utilities", std::vector<double>{ 1.0, 2.0 });
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning());
+  EXPECT_EQ(2, bb->get<int>("result"));
+
+  bb->set("utilities", std::vector<double>{ 3.0, 2.0 });
+  EXPECT_EQ(NodeStatus::SUCCESS, tree.tickWhileRunning());
+  EXPECT_EQ(1, bb->get<int>("result"));
+  EXPECT_EQ(std::vector<double>({ 3.0, 2.0 }), GetSelector(tree)->scores());
+
+  // one score per child
+  bb->set("utilities", std::vector<double>{ 1.0, 2.0, 3.0 });
+  EXPECT_ANY_THROW(tree.tickWhileRunning());
+}
@@ -26,4 +26,39 @@ inline void RegisterTestTick(BT::BehaviorTreeFactory& factory,
   }
 }
 
+/// Action that returns RUNNING until it is halted.
+class KeepRunningAction : public BT::StatefulActionNode
+{
+public:
+  KeepRunningAction(const std::string& name, const BT::NodeConfig& config)
+    : BT::StatefulActionNode(name, config)
+  {}
+
+  static BT::PortsList providedPorts()
+  {
+    return {};
+  }
+
+  BT::NodeStatus onStart() override
+  {
+    return BT::NodeStatus::RUNNING;
+  }
+
+  BT::NodeStatus onRunning() override
+  {
+    return BT::NodeStatus::RUNNING;
+  }
+
+  void onHalted() override
+  {}
+};
+
+/// Create a tree with a single BehaviorTree, whose content is "body".
+inline BT::Tree CreateTreeFromBody(BT::BehaviorTreeFactory& factory,
+                                   const std::string& body)
+{
+  return factory.createTreeFromText(R"(<root BTCPP_format="4"><BehaviorTree ID="MainTree">)" +
+                                    body + "</BehaviorTree></root>");
+}
+
 #endif  // TEST_HELPER_HPP